@@ -43,4 +43,8 @@ public:
 
     // Check if currently playing
     virtual bool isPlaying() const = 0;
+
+    // Settings that affect note processing changed (part, skill, HOPOs...). Message thread only.
+    // Pipelines that derive note state from a cache rebuild it; realtime pipelines ignore this.
+    virtual void invalidateNoteState() {}
 };
\ No newline at end of file
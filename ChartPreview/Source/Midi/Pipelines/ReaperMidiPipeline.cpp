@@ -28,22 +28,10 @@ void ReaperMidiPipeline::process(const juce::AudioPlayHead::PositionInfo& positi
     if (!reaperProvider.isReaperApiAvailable())
         return;
 
-    PPQ newPosition = position.getPpqPosition().orFallback(0.0);
-    bool nowPlaying = position.getIsPlaying();
-    double bpm = position.getBpm().orFallback(120.0);
-
-    // Update current state
-    currentPosition = newPosition;
-    playing = nowPlaying;
-
-    // Refetch MIDI data whenever it changes (detected via hash)
-    if (checkMidiHashChanged())
-    {
-        refetchAllMidiData();
-    }
-
-    // Process cached notes into noteStateMapArray
-    processCachedNotesIntoState(currentPosition, bpm, sampleRate);
+    // Only track the playhead here. Fetching from REAPER and processing the song into
+    // note state happen on the message thread (refetchIfChanged), never on the audio thread.
+    currentPosition = position.getPpqPosition().orFallback(0.0);
+    playing = position.getIsPlaying();
 }
 
 void ReaperMidiPipeline::setDisplayWindow(PPQ start, PPQ end)
@@ -65,18 +53,18 @@ bool ReaperMidiPipeline::isPlaying() const
 
 void ReaperMidiPipeline::refetchAllMidiData()
 {
-    // Clear all old note and tempo data from the MidiProcessor
+    // Clear all old note data from the MidiProcessor (tempo markers are replaced only if they differ)
     {
         const juce::ScopedLock lock(midiProcessor.noteStateMapLock);
         for (auto& noteStateMap : midiProcessor.noteStateMapArray)
         {
             noteStateMap.clear();
         }
-    }
-
-    {
-        const juce::ScopedLock lock(midiProcessor.tempoTimeSignatureMapLock);
-        midiProcessor.tempoTimeSignatureMap.clear();
+        for (auto& noteIntervals : midiProcessor.noteIntervalArray)
+        {
+            noteIntervals.clear();
+        }
+        midiProcessor.markNoteDataChanged();
     }
 
     // Fetch all midi events from the session (one-time bulk fetch)
@@ -84,8 +72,27 @@ void ReaperMidiPipeline::refetchAllMidiData()
     fetchAllTempoTimeSignatureEvents();
 
     // Process newly fetched notes into state immediately
-    // Default bpm/sampleRate will be updated on next process() call
-    processCachedNotesIntoState(currentPosition, 120.0, 48000.0);
+    // (note processing works in PPQ; bpm/sampleRate are placeholders)
+    processCachedNotesIntoState(120.0, 48000.0);
+}
+
+void ReaperMidiPipeline::refetchIfChanged()
+{
+    if (checkMidiHashChanged())
+    {
+        refetchAllMidiData();
+        return;
+    }
+
+    // Tempo edits don't change the MIDI hash; fetching the markers is cheap and only
+    // bumps the tempo map version when something actually differs
+    fetchAllTempoTimeSignatureEvents();
+
+}
+
+void ReaperMidiPipeline::invalidateNoteState()
+{
+    processCachedNotesIntoState(120.0, 48000.0);
 }
 
 void ReaperMidiPipeline::fetchAllNoteEvents()
@@ -112,32 +119,36 @@ void ReaperMidiPipeline::fetchAllTempoTimeSignatureEvents()
 {
     auto events = reaperProvider.getAllTempoTimeSignatureEvents();
 
-    // Store in MidiProcessor's tempoTimeSignatureMap
-    const juce::ScopedLock lock(midiProcessor.tempoTimeSignatureMapLock);
-    midiProcessor.tempoTimeSignatureMap.clear();
+    TempoTimeSignatureMap fetchedMap;
     for (const auto& event : events)
     {
-        midiProcessor.tempoTimeSignatureMap[event.ppqPosition] = event;
+        fetchedMap[event.ppqPosition] = event;
     }
+
+    auto sameEvent = [](const TempoTimeSignatureEvent& a, const TempoTimeSignatureEvent& b)
+    {
+        return a.ppqPosition == b.ppqPosition && a.bpm == b.bpm &&
+               a.timeSigNumerator == b.timeSigNumerator && a.timeSigDenominator == b.timeSigDenominator &&
+               a.timeSigReset == b.timeSigReset && a.timeSeconds == b.timeSeconds && a.linearTempo == b.linearTempo;
+    };
+
+    // Store in MidiProcessor's tempoTimeSignatureMap, leaving the version alone if nothing changed
+    const juce::ScopedLock lock(midiProcessor.tempoTimeSignatureMapLock);
+    auto& currentMap = midiProcessor.tempoTimeSignatureMap;
+    bool unchanged = currentMap.size() == fetchedMap.size() &&
+                     std::equal(currentMap.begin(), currentMap.end(), fetchedMap.begin(),
+                                [&](const auto& a, const auto& b) { return sameEvent(a.second, b.second); });
+    if (unchanged)
+        return;
+
+    currentMap = std::move(fetchedMap);
+    midiProcessor.tempoMapVersion++;
 }
 
-void ReaperMidiPipeline::processCachedNotesIntoState(PPQ currentPos, double bpm, double sampleRate)
+void ReaperMidiPipeline::processCachedNotesIntoState(double bpm, double sampleRate)
 {
-    // Get notes within current display window from persistent allNotes (not from windowed cache)
+    // Process the whole song from persistent allNotes so the renderer can compile it once.
     // This ensures we use the same PPQ derivation as gridlines (bulk fetched with consistent REAPER state)
-    PPQ clearStart = currentPos - PPQ(PREFETCH_BEHIND);
-    PPQ clearEnd = currentPos + displayWindowSize + PPQ(PREFETCH_AHEAD);
-
-    // Filter allNotes to get only those in the current window
-    std::vector<MidiCache::CachedNote> visibleNotes;
-    for (const auto& note : allNotes)
-    {
-        // Include note if it overlaps with current window
-        if (note.endPPQ > clearStart && note.startPPQ < clearEnd)
-        {
-            visibleNotes.push_back(note);
-        }
-    }
 
     // CRITICAL: Hold the lock for the ENTIRE clear+write operation!
     // This prevents race conditions where the renderer could read an empty noteStateMapArray
@@ -145,17 +156,19 @@ void ReaperMidiPipeline::processCachedNotesIntoState(PPQ currentPos, double bpm,
     {
         const juce::ScopedLock lock(midiProcessor.noteStateMapLock);
 
-        // Clear the range
         for (auto& noteStateMap : midiProcessor.noteStateMapArray)
         {
-            auto lower = noteStateMap.lower_bound(clearStart);
-            auto upper = noteStateMap.upper_bound(clearEnd);
-            noteStateMap.erase(lower, upper);
+            noteStateMap.clear();
+        }
+        for (auto& noteIntervals : midiProcessor.noteIntervalArray)
+        {
+            noteIntervals.clear();
         }
 
         // Delegate note processing to specialized processor (holds lock internally)
-        noteProcessor.processModifierNotes(visibleNotes, midiProcessor.noteStateMapArray, midiProcessor.noteStateMapLock, state);
-        noteProcessor.processPlayableNotes(visibleNotes, midiProcessor.noteStateMapArray, midiProcessor.noteStateMapLock, midiProcessor, state, bpm, sampleRate);
+        noteProcessor.processModifierNotes(allNotes, midiProcessor.noteStateMapArray, midiProcessor.noteIntervalArray, midiProcessor.noteStateMapLock, state);
+        noteProcessor.processPlayableNotes(allNotes, midiProcessor.noteStateMapArray, midiProcessor.noteIntervalArray, midiProcessor.noteStateMapLock, midiProcessor, state, bpm, sampleRate);
+        midiProcessor.markNoteDataChanged();
     }
 }
 
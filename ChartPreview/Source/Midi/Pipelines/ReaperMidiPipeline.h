@@ -37,19 +37,28 @@ public:
     PPQ getCurrentPosition() const override;
     bool isPlaying() const override;
 
+    // Reprocess the cached song into note state with the current settings
+    void invalidateNoteState() override;
+
     // Set the target track index (-1 for auto-detect)
     void setTargetTrackIndex(int trackIndex) { targetTrackIndex = trackIndex; }
     int getTargetTrackIndex() const { return targetTrackIndex; }
 
+    // Everything below reads REAPER and rewrites the note cache, so it is only ever called
+    // from the message thread. The audio thread's process() just tracks the playhead.
+
     // Fetch all note and tempo/timesig data from REAPER (call when track changes or settings change)
     void refetchAllMidiData();
 
+    // Cheap poll for edits: refetch notes only if the track hash changed, refresh tempo markers
+    void refetchIfChanged();
+
     // Bulk fetch all MIDI events (faster than grabbing a smaller window)
     void fetchAllNoteEvents();
     void fetchAllTempoTimeSignatureEvents();
 
 private:
-    void processCachedNotesIntoState(PPQ currentPos, double bpm, double sampleRate);
+    void processCachedNotesIntoState(double bpm, double sampleRate);
     bool checkMidiHashChanged();
 
     MidiProcessor& midiProcessor;
@@ -74,8 +83,5 @@ private:
     PPQ currentPosition{0.0};
     bool playing = false;
 
-    // Filtering parameters (for per-frame window filtering of bulk-fetched data)
-    static constexpr double PREFETCH_AHEAD = 8.0;            // Fetch 2 beats ahead (minimize data accumulation in REAPER mode)
-    static constexpr double PREFETCH_BEHIND = 1.0;           // Keep 1 beat behind (minimize data accumulation in REAPER mode)
     static constexpr double MAX_HIGHWAY_LENGTH = 16.0;       // Maximum highway length in PPQ (16 beats = ~4 measures at 4/4)
 };
\ No newline at end of file
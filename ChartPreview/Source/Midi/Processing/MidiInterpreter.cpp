@@ -11,10 +11,9 @@
 #include "MidiInterpreter.h"
 #include "../Utils/MidiConstants.h"
 
-MidiInterpreter::MidiInterpreter(juce::ValueTree &state, NoteStateMapArray &noteStateMapArray, juce::CriticalSection &noteStateMapLock)
-    : noteStateMapArray(noteStateMapArray),
-      noteStateMapLock(noteStateMapLock),
-      state(state)
+MidiInterpreter::MidiInterpreter(juce::ValueTree &state, ChartSnapshotBuffer &chartSnapshots)
+    : state(state),
+      chartSnapshots(chartSnapshots)
 {
 }
 
@@ -28,11 +27,12 @@ TrackWindow MidiInterpreter::generateTrackWindow(PPQ trackWindowStart, PPQ track
 
     TrackWindow trackWindow;
 
-    const juce::ScopedLock lock(noteStateMapLock);
+    // No lock needed: the snapshot is immutable until our next acquire
+    const ChartSnapshot& chart = acquireSnapshot();
 
     for (uint pitch = MIDI_PITCH_MIN; pitch < MIDI_PITCH_COUNT; pitch++)
     {
-        const NoteStateMap& noteStateMap = noteStateMapArray[pitch];
+        const NoteStateMap& noteStateMap = chart.noteStateMapArray[pitch];
         auto it = noteStateMap.lower_bound(trackWindowStart);
         while (it != noteStateMap.end() && it->first < trackWindowEnd)
         {
@@ -97,84 +97,49 @@ SustainWindow MidiInterpreter::generateSustainWindow(PPQ trackWindowStart, PPQ t
 
     SustainWindow sustainWindow;
 
-    // Lock the noteStateMapArray during iteration to prevent crashes
-    const juce::ScopedLock lock(noteStateMapLock);
+    const ChartSnapshot& chart = acquireSnapshot();
 
-    using Drums = MidiPitchDefinitions::Drums;
-    using Guitar = MidiPitchDefinitions::Guitar;
-
-    for (uint pitch = MIDI_PITCH_MIN; pitch < MIDI_PITCH_COUNT; pitch++)
+    // Lanes - paired intervals give the exact note-off; held notes extend to the latency buffer end
+    laneIndex.forEachOverlapping(trackWindowStart, trackWindowEnd, [&](const IntervalIndex<NoteInterval>::Entry& entry)
     {
-        const NoteStateMap& noteStateMap = noteStateMapArray[pitch];
-        
-        for (auto it = noteStateMap.begin(); it != noteStateMap.end(); ++it)
-        {
-            PPQ notePPQ = it->first;
-            uint velocity = it->second.velocity;
-            
-            // Only process note-on events (velocity > 0)
-            if (velocity == 0) continue;
-            
-            // Find the corresponding note-off (velocity == 0)
-            auto nextIt = std::next(it);
-            while (nextIt != noteStateMap.end() && nextIt->second.velocity != 0)
-            {
-                ++nextIt;
-            }
+        const NoteInterval& note = entry.value;
 
-            // If corresponding note off exists within the map
-            PPQ noteOffPPQ = (nextIt != noteStateMap.end()) ? 
-                nextIt->first :     // Use found note-off PPQ
-                latencyBufferEnd;   // Extend to latency buffer end if no note-off found
-            
-            // Check if sustain overlaps with current track window (any part)
-            if (notePPQ < trackWindowEnd && noteOffPPQ > trackWindowStart) {
-                
-                // Lanes
-                if (pitch == (uint)Drums::LANE_1 || pitch == (uint)Drums::LANE_2 ||
-                    pitch == (uint)Guitar::LANE_1 || pitch == (uint)Guitar::LANE_2) {
-                    // Extend lane start time slightly earlier for better visibility
-                    PPQ extendedStartPPQ = notePPQ - MIDI_LANE_EXTENSION_TIME;
-                    
-                    // Use lane detection logic to determine which columns to create lanes for
-                    auto lanes = LaneDetector::detectLanes(pitch, extendedStartPPQ, noteOffPPQ,
-                                                           velocity, state, noteStateMapArray, noteStateMapLock);
-                    
-                    // Add detected lanes to window
-                    for (const auto& lane : lanes) {
-                        sustainWindow.push_back(lane);
-                    }
-                }
-                // Sustains (guitar only)
-                else if (isPart(state, Part::GUITAR)) {
-                    // Only create sustains for valid playable notes (OPEN, GREEN, RED, YELLOW, BLUE, ORANGE)
-                    SkillLevel currentSkill = (SkillLevel)((int)state.getProperty("skillLevel"));
-                    auto validPitches = InstrumentMapper::getGuitarPitchesForSkill(currentSkill);
-                    bool isValidPlayablePitch = std::find(validPitches.begin(), validPitches.end(), pitch) != validPitches.end();
-
-                    if (isValidPlayablePitch) {
-                        PPQ duration = noteOffPPQ - notePPQ;
-                        if (duration >= MIDI_MIN_SUSTAIN_LENGTH) {
-                            uint gemColumn = InstrumentMapper::getGuitarColumn(pitch, currentSkill);
-                            if (gemColumn < LANE_COUNT) {
-                                // Check if star power is held at the start of this sustain
-                                bool isSpHeld = isNoteHeld(static_cast<uint>(Guitar::SP), notePPQ);
-
-                                SustainEvent sustain;
-                                sustain.startPPQ = notePPQ;
-                                sustain.endPPQ = noteOffPPQ;
-                                sustain.gemColumn = gemColumn;
-                                sustain.sustainType = SustainType::SUSTAIN;
-                                sustain.gemType = GemWrapper(it->second.gemType, isSpHeld);
-                                sustainWindow.push_back(sustain);
-                            }
-                        }
-                    }
-                }
-            }
+        // Extend lane start time slightly earlier for better visibility
+        PPQ extendedStartPPQ = note.startPPQ - MIDI_LANE_EXTENSION_TIME;
+
+        // Use lane detection logic to determine which columns to create lanes for
+        auto lanes = LaneDetector::detectLanes(note.pitch, extendedStartPPQ, note.getEnd(latencyBufferEnd),
+                                               note.velocity, state, chart.noteStateMapArray);
+
+        // Add detected lanes to window
+        for (const auto& lane : lanes) {
+            sustainWindow.push_back(lane);
         }
-    }
-    
+    });
+
+    // Sustains (guitar only - the index only holds valid playable pitches for the current skill)
+    SkillLevel currentSkill = (SkillLevel)((int)state.getProperty("skillLevel"));
+    sustainIndex.forEachOverlapping(trackWindowStart, trackWindowEnd, [&](const IntervalIndex<NoteInterval>::Entry& entry)
+    {
+        const NoteInterval& note = entry.value;
+        PPQ noteOffPPQ = note.getEnd(latencyBufferEnd);
+
+        PPQ duration = noteOffPPQ - note.startPPQ;
+        if (duration < MIDI_MIN_SUSTAIN_LENGTH) return;
+
+        uint gemColumn = InstrumentMapper::getGuitarColumn(note.pitch, currentSkill);
+        if (gemColumn >= LANE_COUNT) return;
+
+        SustainEvent sustain;
+        sustain.startPPQ = note.startPPQ;
+        sustain.endPPQ = noteOffPPQ;
+        sustain.gemColumn = gemColumn;
+        sustain.sustainType = SustainType::SUSTAIN;
+        // Check if star power is held at the start of this sustain
+        sustain.gemType = GemWrapper(note.gemType, isStarPowerHeld(note.startPPQ));
+        sustainWindow.push_back(sustain);
+    });
+
     return sustainWindow;
 }
 
@@ -217,13 +182,64 @@ TrackFrame MidiInterpreter::generateEmptyTrackFrame()
     return frame;
 }
 
+const ChartSnapshot &MidiInterpreter::acquireSnapshot()
+{
+    const ChartSnapshot &chart = chartSnapshots.acquire();
+    updateIntervalIndices(chart);
+    return chart;
+}
+
+void MidiInterpreter::updateIntervalIndices(const ChartSnapshot &chart)
+{
+    int part = (int)state.getProperty("part");
+    int skill = (int)state.getProperty("skillLevel");
+
+    if (intervalIndicesValid && indexedNoteDataVersion == chart.version &&
+        indexedPart == part && indexedSkill == skill)
+        return;
+
+    using Guitar = MidiPitchDefinitions::Guitar;
+    using Drums = MidiPitchDefinitions::Drums;
+
+    auto addPitch = [&chart](IntervalIndex<NoteInterval> &index, uint pitch)
+    {
+        for (const auto &note : chart.noteIntervalArray[pitch])
+        {
+            if (note.velocity == 0) continue;
+            index.add(note.startPPQ, note.open ? IntervalIndex<NoteInterval>::openEnd() : note.endPPQ, note);
+        }
+    };
+
+    laneIndex.clear();
+    addPitch(laneIndex, (uint)Drums::LANE_1);
+    addPitch(laneIndex, (uint)Drums::LANE_2);
+    laneIndex.build();
+
+    // Guitar and drums share the star power pitch
+    starPowerIndex.clear();
+    addPitch(starPowerIndex, (uint)Guitar::SP);
+    starPowerIndex.build();
+
+    sustainIndex.clear();
+    if (isPart(state, Part::GUITAR))
+    {
+        for (uint pitch : InstrumentMapper::getGuitarPitchesForSkill((SkillLevel)skill))
+            addPitch(sustainIndex, pitch);
+    }
+    sustainIndex.build();
+
+    intervalIndicesValid = true;
+    indexedNoteDataVersion = chart.version;
+    indexedPart = part;
+    indexedSkill = skill;
+}
+
 void MidiInterpreter::addGuitarEventToFrame(TrackFrame &frame, PPQ position, uint pitch, Gem gemType)
 {
     uint gemColumn = InstrumentMapper::getGuitarColumn(pitch, (SkillLevel)((int)state.getProperty("skillLevel")));
     if (gemColumn < LANE_COUNT) {
         // Check if star power is held at this position (MIDI pitch 116)
-        using Guitar = MidiPitchDefinitions::Guitar;
-        bool isSpHeld = isNoteHeld(static_cast<uint>(Guitar::SP), position);
+        bool isSpHeld = isStarPowerHeld(position);
         frame[gemColumn] = GemWrapper(gemType, isSpHeld);
     }
 }
@@ -233,8 +249,7 @@ void MidiInterpreter::addDrumEventToFrame(TrackFrame &frame, PPQ position, uint
     uint gemColumn = InstrumentMapper::getDrumColumn(pitch, (SkillLevel)((int)state.getProperty("skillLevel")), (bool)state.getProperty("kick2x"));
     if (gemColumn < LANE_COUNT) {
         // Check if star power is held at this position (MIDI pitch 116)
-        using Drums = MidiPitchDefinitions::Drums;
-        bool isSpHeld = isNoteHeld(static_cast<uint>(Drums::SP), position);
+        bool isSpHeld = isStarPowerHeld(position);
         frame[gemColumn] = GemWrapper(gemType, isSpHeld);
     }
 }
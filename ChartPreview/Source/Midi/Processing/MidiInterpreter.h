@@ -17,21 +17,24 @@
 #include "../Utils/InstrumentMapper.h"
 #include "../Utils/GemCalculator.h"
 #include "../Utils/LaneDetector.h"
+#include "../Utils/IntervalIndex.h"
+#include "../Utils/ChartSnapshot.h"
 
 class MidiInterpreter
 {
 	public:
-		MidiInterpreter(juce::ValueTree &state, NoteStateMapArray &noteStateMapArray, juce::CriticalSection &noteStateMapLock);
+		MidiInterpreter(juce::ValueTree &state, ChartSnapshotBuffer &chartSnapshots);
 		~MidiInterpreter();
 
-		NoteStateMapArray &noteStateMapArray;
-		juce::CriticalSection &noteStateMapLock;
-
-		bool isNoteHeld(uint pitch, PPQ position)
+		// Star power phrase lookup via the interval index of the current snapshot
+		bool isStarPowerHeld(PPQ position) const
 		{
-			return ChordAnalyzer::isNoteHeld(pitch, position, noteStateMapArray, noteStateMapLock);
+			return starPowerIndex.contains(position);
 		}
 
+		// Version of the newest published chart snapshot
+		uint64_t getChartVersion() { return acquireSnapshot().version; }
+
 		TrackWindow generateTrackWindow(PPQ trackWindowStart, PPQ trackWindowEnd);
 		SustainWindow generateSustainWindow(PPQ trackWindowStart, PPQ trackWindowEnd, PPQ latencyBufferEnd);
 		TrackFrame generateEmptyTrackFrame();
@@ -39,6 +42,23 @@ class MidiInterpreter
 	private:
 		juce::ValueTree &state;
 
+		// Lock-free view of the chart; only this interpreter consumes it
+		ChartSnapshotBuffer &chartSnapshots;
+
+		// Picks up the newest published snapshot and refreshes the indices for it
+		const ChartSnapshot &acquireSnapshot();
+
+		// Overlap indices over the paired note intervals, rebuilt only when note data or settings change
+		IntervalIndex<NoteInterval> sustainIndex;
+		IntervalIndex<NoteInterval> laneIndex;
+		IntervalIndex<NoteInterval> starPowerIndex;
+		bool intervalIndicesValid = false;
+		uint64_t indexedNoteDataVersion = 0;
+		int indexedPart = -1;
+		int indexedSkill = -1;
+
+		void updateIntervalIndices(const ChartSnapshot &chart);
+
 		void addGuitarEventToFrame(TrackFrame &frame, PPQ position, uint pitch, Gem gemType);
 		void addDrumEventToFrame(TrackFrame &frame, PPQ position, uint pitch, Gem gemType);
 
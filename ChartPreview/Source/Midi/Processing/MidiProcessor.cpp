@@ -6,6 +6,7 @@
 
 MidiProcessor::MidiProcessor(juce::ValueTree &state) : state(state)
 {
+    deferredNotes.reserve(MIDI_MAX_DEFERRED_MESSAGES);
 }
 
 void MidiProcessor::process(juce::MidiBuffer &midiMessages,
@@ -27,9 +28,20 @@ void MidiProcessor::process(juce::MidiBuffer &midiMessages,
     // Use stable host BPM for latency calculation (for audio processing cleanup)
     PPQ latencyPPQ = calculatePPQSegment(latencyInSamples, *bpm, sampleRate);
 
-    cleanupOldEvents(startPPQ, endPPQ, latencyPPQ); // Placeholder for visual window bounds
-    processMidiMessages(midiMessages, startPPQ, sampleRate, *bpm);
-    
+    // The audio thread never waits on the message thread (snapshot publish, REAPER refresh).
+    // If the note state is busy, hold this block's notes until a block that gets the lock;
+    // every nested lock below is then a re-entry on this thread and can't block.
+    const juce::ScopedTryLock lock(noteStateMapLock);
+    if (lock.isLocked())
+    {
+        cleanupOldEvents(startPPQ, endPPQ, latencyPPQ); // Placeholder for visual window bounds
+        processMidiMessages(midiMessages, startPPQ, sampleRate, *bpm);
+    }
+    else
+    {
+        deferMidiMessages(midiMessages, startPPQ, sampleRate, *bpm);
+    }
+
     // Update last processed PPQ for cleanup tracking
     lastProcessedPPQ = std::max(endPPQ, lastProcessedPPQ);
 }
@@ -54,11 +66,13 @@ void MidiProcessor::cleanupOldEvents(PPQ startPPQ, PPQ endPPQ, PPQ latencyPPQ)
     PPQ conservativeStartPPQ = startPPQ - latencyPPQ;
     PPQ conservativeEndPPQ = startPPQ + latencyPPQ;
     
-    // Get current visual window bounds to clamp cleanup
+    // Get current visual window bounds to clamp cleanup. Without them cleanup could
+    // erase visible events, so if the editor is updating them just try again next block.
     PPQ currentVisualStart = PPQ(0.0);
     PPQ currentVisualEnd = PPQ(0.0);
     {
-        const juce::ScopedLock lock(visualWindowLock);
+        const juce::ScopedTryLock lock(visualWindowLock);
+        if (!lock.isLocked()) return;
         currentVisualStart = visualWindowStartPPQ;
         currentVisualEnd = visualWindowEndPPQ;
     }
@@ -77,8 +91,10 @@ void MidiProcessor::cleanupOldEvents(PPQ startPPQ, PPQ endPPQ, PPQ latencyPPQ)
     // Erase notes in PPQ range
     {
         const juce::ScopedLock lock(noteStateMapLock);
+        size_t erasedCount = 0;
         for (auto &noteStateMap : noteStateMapArray)
         {
+            size_t sizeBefore = noteStateMap.size();
             auto lower = noteStateMap.upper_bound(conservativeStartPPQ);
             // Keep 2 events before window to prevent sustain modifier note ons from being deleted
             if (lower != noteStateMap.begin()) --lower;
@@ -87,7 +103,21 @@ void MidiProcessor::cleanupOldEvents(PPQ startPPQ, PPQ endPPQ, PPQ latencyPPQ)
 
             auto upper = noteStateMap.upper_bound(conservativeEndPPQ);
             noteStateMap.erase(upper, noteStateMap.end());
+            erasedCount += sizeBefore - noteStateMap.size();
         }
+
+        // Intervals know their own end, so held modifiers survive without the 2-event margin.
+        // They can go while every event of their pitch stays, so they count as changes too.
+        for (auto &noteIntervals : noteIntervalArray)
+        {
+            size_t sizeBefore = noteIntervals.size();
+            noteIntervals.eraseEndingBefore(conservativeStartPPQ);
+            noteIntervals.eraseStartingAfter(conservativeEndPPQ);
+            erasedCount += sizeBefore - noteIntervals.size();
+        }
+
+        if (erasedCount > 0)
+            markNoteDataChanged();
     }
 }
 
@@ -110,6 +140,14 @@ void MidiProcessor::processMidiMessages(juce::MidiBuffer &midiMessages, PPQ star
     
     std::vector<NoteMessage> noteMessages;
     uint numMessages = 0;
+
+    // Notes held back from earlier blocks; the sort below puts them back in time order
+    for (const auto& deferred : deferredNotes)
+    {
+        uint pitch = deferred.message.getNoteNumber();
+        noteMessages.push_back({deferred.message, deferred.position, pitch, InstrumentMapper::isModifier(pitch)});
+    }
+    deferredNotes.clear();
     
     for (const auto message : midiMessages)
     {
@@ -157,10 +195,31 @@ void MidiProcessor::processMidiMessages(juce::MidiBuffer &midiMessages, PPQ star
     }
 }
 
+void MidiProcessor::deferMidiMessages(juce::MidiBuffer &midiMessages, PPQ startPPQ, double sampleRate, double bpm)
+{
+    uint numMessages = 0;
+
+    for (const auto message : midiMessages)
+    {
+        auto midiMessage = message.getMessage();
+        if (midiMessage.isNoteOn() || midiMessage.isNoteOff())
+        {
+            // Past the reserved capacity the note is dropped rather than allocating here
+            if (deferredNotes.size() >= MIDI_MAX_DEFERRED_MESSAGES) break;
+
+            PPQ messagePositionPPQ = startPPQ + calculatePPQSegment(message.samplePosition, bpm, sampleRate);
+            deferredNotes.push_back({midiMessage, messagePositionPPQ});
+        }
+
+        if (++numMessages >= MIDI_MAX_MESSAGES_PER_BLOCK) break;
+    }
+}
+
 void MidiProcessor::processNoteMessage(const juce::MidiMessage &midiMessage, PPQ messagePPQ)
 {
     uint noteNumber = midiMessage.getNoteNumber();
     uint velocity = midiMessage.isNoteOn() ? midiMessage.getVelocity() : 0;
+    PPQ notePPQ = messagePPQ;
 
     // Ensure notes that stop and start at the same PPQ are processed in correct order
     if (midiMessage.isNoteOff()) {
@@ -180,6 +239,14 @@ void MidiProcessor::processNoteMessage(const juce::MidiMessage &midiMessage, PPQ
 
     const juce::ScopedLock lock(noteStateMapLock);
     noteStateMapArray[noteNumber][messagePPQ] = NoteData(velocity, gemType);
+
+    // Pair on/off into an interval, keeping the exact (un-shifted) note-off position
+    if (velocity > 0)
+        noteIntervalArray[noteNumber].open(notePPQ, (uint8_t)noteNumber, (uint8_t)velocity, gemType);
+    else
+        noteIntervalArray[noteNumber].close(notePPQ);
+
+    markNoteDataChanged();
 }
 
 bool MidiProcessor::isChordFormed(uint pitch, PPQ position)
@@ -228,9 +295,12 @@ void MidiProcessor::fixChordHOPOs(uint pitch, PPQ position)
             if (it->second.velocity > 0 && it->second.gemType == Gem::HOPO_GHOST) {
                 // Change HOPO to regular note since it's part of a chord
                 it->second.gemType = Gem::NOTE;
+                noteIntervalArray[chordPitch].setGemAt(it->first, Gem::NOTE);
             }
         }
     }
+
+    markNoteDataChanged();
 }
 
 uint MidiProcessor::getGuitarGemColumn(uint pitch)
@@ -263,7 +333,7 @@ void MidiProcessor::refreshMidiDisplay()
     {
         NoteStateMap& noteStateMap = noteStateMapArray[pitch];
 
-        for (auto& noteEntry : noteStateMap)
+        for (auto noteEntry : noteStateMap)
         {
             PPQ position = noteEntry.first;
             NoteData& noteData = noteEntry.second;
@@ -278,9 +348,29 @@ void MidiProcessor::refreshMidiDisplay()
                     Dynamic dynamic = (Dynamic)noteData.velocity;
                     noteData.gemType = getDrumGemType(pitch, position, dynamic);
                 }
+                noteIntervalArray[pitch].setGemAt(position, noteData.gemType);
             }
         }
     }
+
+    markNoteDataChanged();
+}
+
+void MidiProcessor::publishSnapshot()
+{
+    const juce::ScopedLock lock(noteStateMapLock);
+
+    if (noteDataVersion == publishedNoteDataVersion)
+        return;
+
+    // Flat per-pitch storage keeps this a handful of contiguous copies
+    ChartSnapshot& snapshot = chartSnapshots.getWriteSlot();
+    snapshot.version = noteDataVersion;
+    snapshot.noteStateMapArray = noteStateMapArray;
+    snapshot.noteIntervalArray = noteIntervalArray;
+    chartSnapshots.publish();
+
+    publishedNoteDataVersion = noteDataVersion;
 }
 
 void MidiProcessor::clearNoteDataInRange(PPQ startPPQ, PPQ endPPQ)
@@ -290,8 +380,13 @@ void MidiProcessor::clearNoteDataInRange(PPQ startPPQ, PPQ endPPQ)
     // Clear notes in the specified PPQ range for all pitches
     for (auto& noteStateMap : noteStateMapArray)
     {
-        auto lower = noteStateMap.lower_bound(startPPQ);
-        auto upper = noteStateMap.upper_bound(endPPQ);
-        noteStateMap.erase(lower, upper);
+        noteStateMap.eraseRange(startPPQ, endPPQ);
     }
+
+    for (auto& noteIntervals : noteIntervalArray)
+    {
+        noteIntervals.eraseRange(startPPQ, endPPQ);
+    }
+
+    markNoteDataChanged();
 }
\ No newline at end of file
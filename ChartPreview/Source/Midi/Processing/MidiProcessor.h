@@ -3,6 +3,7 @@
 #include "../../Utils/Utils.h"
 #include "../../Utils/TimeConverter.h"
 #include "../Utils/MidiTypes.h"
+#include "../Utils/ChartSnapshot.h"
 #include "../Utils/ChordAnalyzer.h"
 #include "../Utils/InstrumentMapper.h"
 #include "../Utils/GemCalculator.h"
@@ -22,11 +23,26 @@ public:
                  double sampleRate);
 
     NoteStateMapArray noteStateMapArray;
+    NoteIntervalArray noteIntervalArray;     // Paired note on/off records, guarded by noteStateMapLock
     TempoTimeSignatureMap tempoTimeSignatureMap;
     mutable juce::CriticalSection tempoTimeSignatureMapLock;
+    std::atomic<uint64_t> tempoMapVersion { 0 };  // Bumped under tempoTimeSignatureMapLock on every change; readable without it
     mutable juce::CriticalSection noteStateMapLock;
     PPQ lastProcessedPPQ = 0.0;
 
+    // Bumped on every note data change (caller must hold noteStateMapLock)
+    uint64_t noteDataVersion = 0;
+    void markNoteDataChanged() { ++noteDataVersion; }
+
+    // Lock-free hand-off of the note state to the renderer
+    ChartSnapshotBuffer chartSnapshots;
+
+    // Copy the working note state into a fresh snapshot if it changed since the last publish.
+    // Message thread only: the copy allocates and is proportional to the note count, so the
+    // audio thread just edits the working state and bumps noteDataVersion. It only try-locks
+    // noteStateMapLock, so holding it here delays the audio thread's notes but never blocks it.
+    void publishSnapshot();
+
     void setLastProcessedPosition(const juce::AudioPlayHead::PositionInfo &positionInfo)
     {
         lastProcessedPPQ = positionInfo.getPpqPosition().orFallback(lastProcessedPPQ);
@@ -57,6 +73,7 @@ private:
     PPQ calculatePPQSegment(uint samples, double bpm, double sampleRate);
     void cleanupOldEvents(PPQ startPPQ, PPQ endPPQ, PPQ latencyPPQ);
     void processMidiMessages(juce::MidiBuffer &midiMessages, PPQ startPPQ, double sampleRate, double bpm);
+    void deferMidiMessages(juce::MidiBuffer &midiMessages, PPQ startPPQ, double sampleRate, double bpm);
     void processNoteMessage(const juce::MidiMessage &midiMessage, PPQ messagePPQ);
     bool isChordFormed(uint pitch, PPQ position);
     void fixChordHOPOs(uint pitch, PPQ position);
@@ -70,4 +87,15 @@ private:
     PPQ visualWindowStartPPQ = PPQ(0.0);
     PPQ visualWindowEndPPQ = PPQ(0.0);
     mutable juce::CriticalSection visualWindowLock;
+
+    uint64_t publishedNoteDataVersion = 0;
+
+    // Note messages from blocks where the audio thread couldn't take noteStateMapLock
+    // without waiting. Reserved up front and drained by the next block that gets the lock.
+    struct DeferredNote
+    {
+        juce::MidiMessage message;
+        PPQ position;
+    };
+    std::vector<DeferredNote> deferredNotes;
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 void NoteProcessor::processModifierNotes(
     const std::vector<MidiCache::CachedNote>& notes,
     NoteStateMapArray& noteStateMapArray,
+    NoteIntervalArray& noteIntervalArray,
     juce::CriticalSection& noteStateMapLock,
     juce::ValueTree& state)
 {
@@ -31,22 +32,36 @@ void NoteProcessor::processModifierNotes(
 
     const juce::ScopedLock lock(noteStateMapLock);
 
+    // Modifiers don't read the map while being added, so collect each pitch's
+    // on/off markers and append them in one sorted pass instead of per-note inserts
+    std::vector<std::vector<std::pair<PPQ, NoteData>>> markersByPitch(noteStateMapArray.size());
+
     for (const auto& note : notes)
     {
         if (note.muted) continue;
 
         // Check if this is a valid modifier pitch
         bool isModifier = std::find(validModifierPitches.begin(), validModifierPitches.end(), note.pitch) != validModifierPitches.end();
-        if (!isModifier) continue;
+        if (!isModifier || note.pitch >= markersByPitch.size()) continue;
 
-        // Add modifier to note state map (no gem type needed for modifiers)
-        addNoteToMap(noteStateMapArray, note.pitch, note.startPPQ, note.endPPQ, NoteData(note.velocity, Gem::NONE));
+        // Same markers as addNoteToMap (no gem type needed for modifiers)
+        auto& markers = markersByPitch[note.pitch];
+        markers.emplace_back(note.startPPQ, NoteData(note.velocity, Gem::NONE));
+        markers.emplace_back(std::max(note.startPPQ + PPQ(1), note.endPPQ - PPQ(1)), NoteData(0, Gem::NONE));
+        addNoteInterval(noteIntervalArray, note.pitch, note.startPPQ, note.endPPQ, NoteData(note.velocity, Gem::NONE));
+    }
+
+    for (size_t pitch = 0; pitch < markersByPitch.size(); pitch++)
+    {
+        if (!markersByPitch[pitch].empty())
+            noteStateMapArray[pitch].appendBulk(std::move(markersByPitch[pitch]));
     }
 }
 
 void NoteProcessor::processPlayableNotes(
     const std::vector<MidiCache::CachedNote>& notes,
     NoteStateMapArray& noteStateMapArray,
+    NoteIntervalArray& noteIntervalArray,
     juce::CriticalSection& noteStateMapLock,
     MidiProcessor& midiProcessor,
     juce::ValueTree& state,
@@ -105,6 +120,20 @@ void NoteProcessor::processPlayableNotes(
         std::vector<PPQ> positions(guitarNotePositions.begin(), guitarNotePositions.end());
         ChordAnalyzer::fixChordHOPOs(positions, currentSkill, noteStateMapArray, noteStateMapLock);
     }
+
+    // Build intervals last so they carry the chord-fixed gem types
+    for (const auto& note : notes)
+    {
+        if (note.muted || note.pitch >= noteStateMapArray.size()) continue;
+
+        bool isValidPlayablePitch = std::find(validPlayablePitches.begin(), validPlayablePitches.end(),
+                                             note.pitch) != validPlayablePitches.end();
+        if (!isValidPlayablePitch) continue;
+
+        auto it = noteStateMapArray[note.pitch].lower_bound(note.startPPQ);
+        Gem gemType = (it != noteStateMapArray[note.pitch].end() && it->first == note.startPPQ) ? it->second.gemType : Gem::NONE;
+        addNoteInterval(noteIntervalArray, note.pitch, note.startPPQ, note.endPPQ, NoteData(note.velocity, gemType));
+    }
 }
 
 void NoteProcessor::addNoteToMap(NoteStateMapArray& noteStateMapArray, uint pitch, PPQ startPPQ, PPQ endPPQ, const NoteData& data)
@@ -116,4 +145,13 @@ void NoteProcessor::addNoteToMap(NoteStateMapArray& noteStateMapArray, uint pitc
         // endPPQ - 1 ensures we don't overwrite the next note's start 
         noteStateMapArray[pitch][std::max(startPPQ + PPQ(1), endPPQ - PPQ(1))] = NoteData(0, Gem::NONE);
     }
+}
+
+void NoteProcessor::addNoteInterval(NoteIntervalArray& noteIntervalArray, uint pitch, PPQ startPPQ, PPQ endPPQ, const NoteData& data)
+{
+    if (pitch < noteIntervalArray.size())
+    {
+        // Intervals keep the exact note-off, unlike the shifted marker above
+        noteIntervalArray[pitch].add(NoteInterval(startPPQ, std::max(startPPQ, endPPQ), (uint8_t)pitch, data.velocity, data.gemType));
+    }
 }
\ No newline at end of file
@@ -29,6 +29,7 @@ public:
     void processModifierNotes(
         const std::vector<MidiCache::CachedNote>& notes,
         NoteStateMapArray& noteStateMapArray,
+        NoteIntervalArray& noteIntervalArray,
         juce::CriticalSection& noteStateMapLock,
         juce::ValueTree& state);
 
@@ -36,6 +37,7 @@ public:
     void processPlayableNotes(
         const std::vector<MidiCache::CachedNote>& notes,
         NoteStateMapArray& noteStateMapArray,
+        NoteIntervalArray& noteIntervalArray,
         juce::CriticalSection& noteStateMapLock,
         MidiProcessor& midiProcessor,
         juce::ValueTree& state,
@@ -45,4 +47,7 @@ public:
 private:
     // Caller must hold noteStateMapLock!
     void addNoteToMap(NoteStateMapArray& noteStateMapArray, uint pitch, PPQ startPPQ, PPQ endPPQ, const NoteData& data);
+
+    // Caller must hold noteStateMapLock!
+    void addNoteInterval(NoteIntervalArray& noteIntervalArray, uint pitch, PPQ startPPQ, PPQ endPPQ, const NoteData& data);
 };
@@ -49,13 +49,24 @@ bool ReaperMidiProvider::initialize(void* (*reaperGetApiFunc)(const char*))
 
 void ReaperMidiProvider::processTempoMarkers(void* project, std::vector<TempoTimeSignatureEvent>& events)
 {
-    if (!apis.CountTempoTimeSigMarkers || !apis.GetTempoTimeSigMarker)
+    if (!apis.CountTempoTimeSigMarkers || !apis.GetTempoTimeSigMarker || !apis.TimeMap2_timeToQN)
         return;
 
     int markerCount = apis.CountTempoTimeSigMarkers(project);
     if (markerCount == 0)
     {
-        events.push_back(TempoTimeSignatureEvent(PPQ(0.0), 120.0, 4, 4));
+        // No markers: the project tempo applies everywhere (120 BPM if it can't be queried)
+        double projectBpm = 120.0;
+        if (apis.TimeMap2_QNToTime)
+        {
+            double secondsPerBeat = apis.TimeMap2_QNToTime(project, 1.0) - apis.TimeMap2_QNToTime(project, 0.0);
+            if (secondsPerBeat > 0.0)
+                projectBpm = 60.0 / secondsPerBeat;
+        }
+
+        TempoTimeSignatureEvent event(PPQ(0.0), projectBpm, 4, 4);
+        event.timeSeconds = 0.0;
+        events.push_back(event);
         return;
     }
 
@@ -86,7 +97,10 @@ void ReaperMidiProvider::processTempoMarkers(void* project, std::vector<TempoTim
             timeSigReset = true;
         }
 
-        events.push_back(TempoTimeSignatureEvent(PPQ(ppq), currentBpm, currentTimeSigNum, currentTimeSigDenom, timeSigReset));
+        TempoTimeSignatureEvent event(PPQ(ppq), currentBpm, currentTimeSigNum, currentTimeSigDenom, timeSigReset);
+        event.timeSeconds = timepos;
+        event.linearTempo = lineartempo;
+        events.push_back(event);
     }
 
     if (logger)
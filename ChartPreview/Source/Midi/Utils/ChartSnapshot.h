@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    ChartSnapshot.h
+    Immutable, versioned copy of the chart note state for the renderer
+
+    The MIDI side owns the working note state and mutates it under
+    noteStateMapLock. The message thread copies the state into a
+    ChartSnapshotBuffer slot once per frame when it changed, and publishes
+    it with a single atomic exchange (triple buffering). The audio thread
+    never publishes, since the copy allocates, and only try-locks the note
+    state: while a copy holds the lock its notes wait for the next block.
+    The renderer acquires the newest snapshot without taking any lock and
+    reads it while the producer keeps working in the other slots.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include "MidiTypes.h"
+
+struct ChartSnapshot
+{
+    uint64_t version = 0;           // Producer's noteDataVersion at publish time
+    NoteStateMapArray noteStateMapArray;
+    NoteIntervalArray noteIntervalArray;
+};
+
+// Single producer (the message thread), single consumer (the renderer)
+class ChartSnapshotBuffer
+{
+public:
+    //==============================================================================
+    // Producer
+
+    // Slot owned by the producer; may hold data from an older publish
+    ChartSnapshot& getWriteSlot() { return slots[writeIndex]; }
+
+    // Hand the write slot to the consumer and take back whichever slot it released
+    void publish()
+    {
+        latestVersion.store(slots[writeIndex].version, std::memory_order_release);
+        writeIndex = middle.exchange(writeIndex | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    //==============================================================================
+    // Any thread
+
+    // Version of the newest published snapshot, for change detection without acquiring it
+    uint64_t getLatestVersion() const { return latestVersion.load(std::memory_order_acquire); }
+
+    //==============================================================================
+    // Consumer
+
+    // Newest published snapshot. Stays valid and unchanged until the next acquire().
+    const ChartSnapshot& acquire()
+    {
+        if (middle.load(std::memory_order_acquire) & FRESH_BIT)
+            readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return slots[readIndex];
+    }
+
+private:
+    static constexpr int INDEX_MASK = 0x3;
+    static constexpr int FRESH_BIT = 0x4;
+
+    std::array<ChartSnapshot, 3> slots;
+    int writeIndex = 0;
+    int readIndex = 1;
+    std::atomic<int> middle { 2 };
+    std::atomic<uint64_t> latestVersion { 0 };
+};
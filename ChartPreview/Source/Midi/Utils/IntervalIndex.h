@@ -0,0 +1,172 @@
+/*
+  ==============================================================================
+
+    IntervalIndex.h
+    Header-only static interval index for window overlap queries
+
+    Intervals are sorted by start and laid out as an implicit balanced tree
+    over the array (in-order positions), with each node augmented by the
+    maximum end in its subtree. Built once per data change in O(n log n);
+    "everything overlapping [a, b)" costs O(log n + k) and visits results in
+    start order.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "../../Utils/PPQ.h"
+
+template <typename Value>
+class IntervalIndex
+{
+public:
+    struct Entry
+    {
+        PPQ startPPQ;
+        PPQ endPPQ;
+        Value value;
+    };
+
+    // End used for intervals that have not finished yet
+    static PPQ openEnd() { return PPQ(std::numeric_limits<int64_t>::max()); }
+
+    void clear()
+    {
+        entries.clear();
+        maxEnds.clear();
+        maxLevel = -1;
+    }
+
+    // Queue an interval; call build() once all intervals are added
+    void add(PPQ startPPQ, PPQ endPPQ, const Value& value)
+    {
+        entries.push_back({ startPPQ, std::max(startPPQ, endPPQ), value });
+    }
+
+    void build()
+    {
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return a.startPPQ < b.startPPQ;
+        });
+
+        const int64_t n = (int64_t)entries.size();
+        maxEnds.resize(entries.size());
+        maxLevel = -1;
+        if (n == 0) return;
+
+        // Leaves (even indices) hold their own end
+        int64_t lastIndex = 0;
+        PPQ lastMax = entries[0].endPPQ;
+        for (int64_t i = 0; i < n; i += 2)
+        {
+            lastIndex = i;
+            maxEnds[i] = lastMax = entries[i].endPPQ;
+        }
+
+        // Level k nodes sit at indices with k trailing one-bits
+        int k = 1;
+        for (; ((int64_t)1 << k) <= n; ++k)
+        {
+            const int64_t half = (int64_t)1 << (k - 1);
+            const int64_t first = (half << 1) - 1;
+            const int64_t step = half << 2;
+
+            for (int64_t i = first; i < n; i += step)
+            {
+                PPQ leftMax = maxEnds[i - half];
+                PPQ rightMax = (i + half < n) ? maxEnds[i + half] : lastMax;
+                maxEnds[i] = std::max(entries[i].endPPQ, std::max(leftMax, rightMax));
+            }
+
+            // Track the max along the incomplete right spine
+            lastIndex = ((lastIndex >> k) & 1) ? lastIndex - half : lastIndex + half;
+            if (lastIndex < n && maxEnds[lastIndex] > lastMax)
+                lastMax = maxEnds[lastIndex];
+        }
+        maxLevel = k - 1;
+    }
+
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+    const std::vector<Entry>& getEntries() const { return entries; }
+
+    // Visit every interval with start < endPPQ and end > startPPQ, in start order.
+    // The callback may return false to stop early.
+    template <typename Callback>
+    void forEachOverlapping(PPQ startPPQ, PPQ endPPQ, Callback&& callback) const
+    {
+        if (maxLevel < 0) return;
+
+        struct Node { int64_t index; int level; bool leftDone; };
+        Node stack[64];
+        int top = 0;
+        const int64_t n = (int64_t)entries.size();
+
+        stack[top++] = { ((int64_t)1 << maxLevel) - 1, maxLevel, false };
+        while (top > 0)
+        {
+            Node node = stack[--top];
+
+            // Small subtrees are cheaper to scan linearly
+            if (node.level <= SCAN_LEVEL)
+            {
+                int64_t from = node.index >> node.level << node.level;
+                int64_t to = std::min(n, from + ((int64_t)1 << (node.level + 1)) - 1);
+                for (int64_t i = from; i < to && entries[i].startPPQ < endPPQ; ++i)
+                {
+                    if (entries[i].endPPQ > startPPQ && !visit(callback, entries[i]))
+                        return;
+                }
+            }
+            else if (!node.leftDone)
+            {
+                const int64_t left = node.index - ((int64_t)1 << (node.level - 1));
+                stack[top++] = { node.index, node.level, true };
+                if (left >= n || maxEnds[left] > startPPQ)
+                    stack[top++] = { left, node.level - 1, false };
+            }
+            else if (node.index < n && entries[node.index].startPPQ < endPPQ)
+            {
+                if (entries[node.index].endPPQ > startPPQ && !visit(callback, entries[node.index]))
+                    return;
+                stack[top++] = { node.index + ((int64_t)1 << (node.level - 1)), node.level - 1, false };
+            }
+        }
+    }
+
+    // True if any interval covers positionPPQ (start <= position < end)
+    bool contains(PPQ positionPPQ) const
+    {
+        bool found = false;
+        forEachOverlapping(positionPPQ, positionPPQ + PPQ(1), [&](const Entry&) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+private:
+    static constexpr int SCAN_LEVEL = 3;
+
+    template <typename Callback>
+    static bool visit(Callback& callback, const Entry& entry)
+    {
+        if constexpr (std::is_same_v<decltype(callback(entry)), bool>)
+            return callback(entry);
+        else
+        {
+            callback(entry);
+            return true;
+        }
+    }
+
+    std::vector<Entry> entries;
+    std::vector<PPQ> maxEnds;
+    int maxLevel = -1;
+};
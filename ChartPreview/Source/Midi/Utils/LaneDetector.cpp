@@ -3,8 +3,7 @@
 
 std::vector<SustainEvent> LaneDetector::detectLanes(uint laneType, PPQ startPPQ, PPQ endPPQ,
                                                     uint laneVelocity, juce::ValueTree& state,
-                                                    NoteStateMapArray& noteStateMapArray,
-                                                    juce::CriticalSection& noteStateMapLock)
+                                                    const NoteStateMapArray& noteStateMapArray)
 {
     using Drums = MidiPitchDefinitions::Drums;
     std::vector<SustainEvent> lanes;
@@ -33,17 +32,20 @@ std::vector<SustainEvent> LaneDetector::detectLanes(uint laneType, PPQ startPPQ,
 
     // Find first notes after lane start to determine column(s)
     std::vector<uint> laneColumns;
-    const juce::ScopedLock lock(noteStateMapLock);
 
-    // Collect all notes in the lane timeframe and sort by time
+    // Only the earliest 1 or 2 notes decide the columns, so each pitch contributes at most that many
+    uint maxNotes = (laneType == (uint)Drums::LANE_2) ? 2 : 1;
+
+    // Collect the first notes in the lane timeframe and sort by time
     std::vector<std::pair<PPQ, uint>> noteEvents; // (time, pitch)
 
     for (uint pitch : instrumentPitches)
     {
         const auto& noteStateMap = noteStateMapArray[pitch];
         auto it = noteStateMap.lower_bound(startPPQ);
+        uint notesForPitch = 0;
 
-        while (it != noteStateMap.end() && it->first <= endPPQ)
+        while (it != noteStateMap.end() && it->first <= endPPQ && notesForPitch < maxNotes)
         {
             if (it->second.velocity > 0)
             { // Note-on event
@@ -52,6 +54,7 @@ std::vector<SustainEvent> LaneDetector::detectLanes(uint laneType, PPQ startPPQ,
                 if (column < LANE_COUNT)
                 { // Valid column
                     noteEvents.push_back({it->first, pitch});
+                    notesForPitch++;
                 }
             }
             ++it;
@@ -62,7 +65,6 @@ std::vector<SustainEvent> LaneDetector::detectLanes(uint laneType, PPQ startPPQ,
     std::sort(noteEvents.begin(), noteEvents.end());
 
     // Take first 1 or 2 notes depending on lane type
-    uint maxNotes = (laneType == (uint)Drums::LANE_2) ? 2 : 1;
     for (size_t i = 0; i < noteEvents.size() && laneColumns.size() < maxNotes; ++i)
     {
         uint column = isPart(state, Part::GUITAR) ? InstrumentMapper::getGuitarColumn(noteEvents[i].second, skill)
@@ -22,6 +22,5 @@ class LaneDetector
 public:
     static std::vector<SustainEvent> detectLanes(uint laneType, PPQ startPPQ, PPQ endPPQ,
                                                   uint laneVelocity, juce::ValueTree& state,
-                                                  NoteStateMapArray& noteStateMapArray,
-                                                  juce::CriticalSection& noteStateMapLock);
+                                                  const NoteStateMapArray& noteStateMapArray);
 };
@@ -23,6 +23,7 @@ inline const PPQ MIDI_TICK_170 = PPQ(170.0 / MIDI_RESOLUTION);
 inline const PPQ MIDI_TICK_EIGHTH = PPQ(240.0 / MIDI_RESOLUTION);
 
 constexpr uint MIDI_MAX_MESSAGES_PER_BLOCK = 256;
+constexpr uint MIDI_MAX_DEFERRED_MESSAGES = 1024;    // Notes held back while the note state is locked elsewhere
 
 inline const PPQ MIDI_CHORD_TOLERANCE = MIDI_TICK_BASE;
 
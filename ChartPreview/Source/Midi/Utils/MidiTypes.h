@@ -15,6 +15,8 @@
 #include <JuceHeader.h>
 #include "../../Utils/PPQ.h"
 #include "../../Utils/Utils.h"
+#include "NoteEventStore.h"
+#include "NoteIntervalList.h"
 
 struct NoteData
 {
@@ -28,8 +30,9 @@ struct NoteData
     operator bool() const { return velocity > 0; }
 };
 
-using NoteStateMap = std::map<PPQ, NoteData>;
+using NoteStateMap = NoteEventStore<NoteData>;
 using NoteStateMapArray = std::array<NoteStateMap, 128>;
+using NoteIntervalArray = std::array<NoteIntervalList, 128>;
 
 enum class Dynamic
 {
@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+    NoteEventStore.h
+    Header-only sorted event storage for a single MIDI pitch
+
+    Keeps ticks and event data in two parallel, tick-sorted vectors so range
+    queries are a binary search over contiguous memory instead of a walk over
+    tree nodes. Exposes the subset of the std::map interface the MIDI code
+    relies on (lower_bound/upper_bound, it->first/it->second, erase ranges,
+    operator[]), plus bulk append and erase-by-range helpers.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "../../Utils/PPQ.h"
+
+template <typename Data>
+class NoteEventStore
+{
+public:
+    // Proxy returned by iterators, mirrors std::map's value_type member names
+    template <bool IsConst>
+    struct EntryRef
+    {
+        const PPQ& first;
+        std::conditional_t<IsConst, const Data&, Data&> second;
+    };
+
+    template <bool IsConst>
+    class Iterator
+    {
+    public:
+        using Store = std::conditional_t<IsConst, const NoteEventStore, NoteEventStore>;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = EntryRef<IsConst>;
+        using difference_type = std::ptrdiff_t;
+        using reference = EntryRef<IsConst>;
+
+        struct pointer
+        {
+            EntryRef<IsConst> entry;
+            const EntryRef<IsConst>* operator->() const { return &entry; }
+        };
+
+        Iterator() = default;
+        Iterator(Store* owner, std::size_t position) : store(owner), index(position) {}
+
+        // Allow iterator -> const_iterator conversion like std::map
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : store(other.store), index(other.index) {}
+
+        reference operator*() const { return { store->ticks[index], store->data[index] }; }
+        pointer operator->() const { return { **this }; }
+
+        Iterator& operator++() { ++index; return *this; }
+        Iterator& operator--() { --index; return *this; }
+        Iterator operator++(int) { auto copy = *this; ++index; return copy; }
+        Iterator operator--(int) { auto copy = *this; --index; return copy; }
+        Iterator& operator+=(difference_type n) { index += n; return *this; }
+        Iterator& operator-=(difference_type n) { index -= n; return *this; }
+        Iterator operator+(difference_type n) const { return Iterator(store, index + n); }
+        Iterator operator-(difference_type n) const { return Iterator(store, index - n); }
+        difference_type operator-(const Iterator& other) const { return (difference_type)index - (difference_type)other.index; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+        bool operator<(const Iterator& other) const { return index < other.index; }
+
+        std::size_t getIndex() const { return index; }
+
+    private:
+        template <bool> friend class Iterator;
+
+        Store* store = nullptr;
+        std::size_t index = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    //==============================================================================
+    // Map-style query surface
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, ticks.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, ticks.size()); }
+
+    bool empty() const { return ticks.empty(); }
+    std::size_t size() const { return ticks.size(); }
+
+    iterator lower_bound(PPQ position) { return iterator(this, lowerIndex(position)); }
+    iterator upper_bound(PPQ position) { return iterator(this, upperIndex(position)); }
+    const_iterator lower_bound(PPQ position) const { return const_iterator(this, lowerIndex(position)); }
+    const_iterator upper_bound(PPQ position) const { return const_iterator(this, upperIndex(position)); }
+
+    // Insert-or-assign; appending in tick order is amortized O(1)
+    Data& operator[](PPQ position)
+    {
+        if (ticks.empty() || ticks.back() < position)
+        {
+            ticks.push_back(position);
+            data.emplace_back();
+            return data.back();
+        }
+
+        std::size_t index = lowerIndex(position);
+        if (ticks[index] != position)
+        {
+            ticks.insert(ticks.begin() + index, position);
+            data.insert(data.begin() + index, Data());
+        }
+        return data[index];
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        std::size_t from = first.getIndex();
+        std::size_t to = last.getIndex();
+        ticks.erase(ticks.begin() + from, ticks.begin() + to);
+        data.erase(data.begin() + from, data.begin() + to);
+        return iterator(this, from);
+    }
+
+    void clear()
+    {
+        ticks.clear();
+        data.clear();
+    }
+
+    //==============================================================================
+    // Bulk operations
+
+    void reserve(std::size_t capacity)
+    {
+        ticks.reserve(capacity);
+        data.reserve(capacity);
+    }
+
+    // Insert-or-assign a batch of events that may arrive out of order. Later events win when
+    // two share a tick, matching repeated operator[] writes. O(n + m log m) for m new events:
+    // the batch is sorted once and merged, instead of m mid-vector inserts.
+    void appendBulk(std::vector<std::pair<PPQ, Data>> events)
+    {
+        if (events.empty()) return;
+
+        // Stable, so equal ticks keep their arrival order and the last one can win
+        std::stable_sort(events.begin(), events.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        std::size_t unique = 0;
+        for (std::size_t i = 0; i < events.size(); i++)
+        {
+            if (unique > 0 && events[unique - 1].first == events[i].first)
+                events[unique - 1].second = events[i].second;
+            else
+                events[unique++] = events[i];
+        }
+        events.resize(unique);
+
+        // Common case: everything lands after the existing events
+        if (ticks.empty() || ticks.back() < events.front().first)
+        {
+            reserve(ticks.size() + events.size());
+            for (const auto& event : events)
+            {
+                ticks.push_back(event.first);
+                data.push_back(event.second);
+            }
+            return;
+        }
+
+        std::vector<PPQ> mergedTicks;
+        std::vector<Data> mergedData;
+        mergedTicks.reserve(ticks.size() + events.size());
+        mergedData.reserve(ticks.size() + events.size());
+
+        std::size_t existing = 0, incoming = 0;
+        while (existing < ticks.size() || incoming < events.size())
+        {
+            bool takeIncoming = existing == ticks.size() ||
+                                (incoming < events.size() && !(ticks[existing] < events[incoming].first));
+            if (takeIncoming)
+            {
+                // A new event replaces an existing one at the same tick
+                if (existing < ticks.size() && ticks[existing] == events[incoming].first)
+                    existing++;
+                mergedTicks.push_back(events[incoming].first);
+                mergedData.push_back(events[incoming].second);
+                incoming++;
+            }
+            else
+            {
+                mergedTicks.push_back(ticks[existing]);
+                mergedData.push_back(data[existing]);
+                existing++;
+            }
+        }
+
+        ticks = std::move(mergedTicks);
+        data = std::move(mergedData);
+    }
+
+    // Erase every event with startPPQ <= tick <= endPPQ
+    void eraseRange(PPQ startPPQ, PPQ endPPQ)
+    {
+        erase(lower_bound(startPPQ), upper_bound(endPPQ));
+    }
+
+    // Direct contiguous access for hot loops
+    const std::vector<PPQ>& getTicks() const { return ticks; }
+    const std::vector<Data>& getData() const { return data; }
+
+private:
+    std::size_t lowerIndex(PPQ position) const
+    {
+        return (std::size_t)(std::lower_bound(ticks.begin(), ticks.end(), position) - ticks.begin());
+    }
+
+    std::size_t upperIndex(PPQ position) const
+    {
+        return (std::size_t)(std::upper_bound(ticks.begin(), ticks.end(), position) - ticks.begin());
+    }
+
+    std::vector<PPQ> ticks;
+    std::vector<Data> data;
+};
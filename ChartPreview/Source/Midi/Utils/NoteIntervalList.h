@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    NoteIntervalList.h
+    Header-only list of paired note-on/note-off intervals for a single pitch
+
+    Notes are stored as explicit (start, end, pitch, velocity, gem) records,
+    sorted by start. A pitch can only sound once at a time, so a new note
+    truncates any interval it lands inside; this keeps the ends sorted too,
+    which lets overlap queries binary search on either edge.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "../../Utils/PPQ.h"
+#include "../../Utils/Utils.h"
+
+struct NoteInterval
+{
+    PPQ startPPQ;
+    PPQ endPPQ;
+    uint8_t pitch = 0;
+    uint8_t velocity = 0;
+    Gem gemType = Gem::NONE;
+    bool open = false;      // Note-off not received yet (realtime input only)
+
+    NoteInterval() = default;
+    NoteInterval(PPQ start, PPQ end, uint8_t notePitch, uint8_t vel, Gem gem, bool isOpen = false)
+        : startPPQ(start), endPPQ(end), pitch(notePitch), velocity(vel), gemType(gem), open(isOpen) {}
+
+    // End used for queries; open notes extend to the caller-supplied horizon
+    PPQ getEnd(PPQ openEndPPQ) const { return open ? std::max(startPPQ, openEndPPQ) : endPPQ; }
+};
+
+class NoteIntervalList
+{
+public:
+    using const_iterator = std::vector<NoteInterval>::const_iterator;
+
+    const_iterator begin() const { return intervals.begin(); }
+    const_iterator end() const { return intervals.end(); }
+    bool empty() const { return intervals.empty(); }
+    size_t size() const { return intervals.size(); }
+    void clear() { intervals.clear(); }
+
+    // Insert or replace the interval starting at note.startPPQ
+    void add(NoteInterval note)
+    {
+        auto it = std::lower_bound(intervals.begin(), intervals.end(), note.startPPQ, startsBefore);
+
+        // Re-adding an existing note (REAPER window refresh) replaces it in place
+        if (it != intervals.end() && it->startPPQ == note.startPPQ)
+        {
+            *it = note;
+            clampToNeighbours(it);
+            return;
+        }
+
+        it = intervals.insert(it, note);
+        clampToNeighbours(it);
+    }
+
+    // Realtime note-on: the note-off arrives later via close()
+    void open(PPQ startPPQ, uint8_t pitch, uint8_t velocity, Gem gemType)
+    {
+        add(NoteInterval(startPPQ, startPPQ, pitch, velocity, gemType, true));
+    }
+
+    // Realtime note-off: closes the latest interval that started at or before endPPQ
+    void close(PPQ endPPQ)
+    {
+        auto it = std::upper_bound(intervals.begin(), intervals.end(), endPPQ, startsAfter);
+        if (it == intervals.begin()) return;
+        --it;
+        if (!it->open) return;
+
+        it->open = false;
+        it->endPPQ = std::max(it->startPPQ, endPPQ);
+    }
+
+    // Update the gem of the interval starting exactly at startPPQ (after chord/HOPO fixes)
+    void setGemAt(PPQ startPPQ, Gem gemType)
+    {
+        auto it = std::lower_bound(intervals.begin(), intervals.end(), startPPQ, startsBefore);
+        if (it != intervals.end() && it->startPPQ == startPPQ)
+            it->gemType = gemType;
+    }
+
+    // First interval whose end reaches past startPPQ - O(log n) since ends are sorted
+    const_iterator firstEndingAfter(PPQ startPPQ, PPQ openEndPPQ) const
+    {
+        return std::partition_point(intervals.begin(), intervals.end(), [&](const NoteInterval& note) {
+            return note.getEnd(openEndPPQ) <= startPPQ;
+        });
+    }
+
+    // Visit every interval overlapping (startPPQ, endPPQ) in start order
+    template <typename Callback>
+    void forEachOverlapping(PPQ startPPQ, PPQ endPPQ, PPQ openEndPPQ, Callback&& callback) const
+    {
+        for (auto it = firstEndingAfter(startPPQ, openEndPPQ); it != intervals.end() && it->startPPQ < endPPQ; ++it)
+            callback(*it);
+    }
+
+    // Remove intervals starting in [startPPQ, endPPQ]
+    void eraseRange(PPQ startPPQ, PPQ endPPQ)
+    {
+        auto lower = std::lower_bound(intervals.begin(), intervals.end(), startPPQ, startsBefore);
+        auto upper = std::upper_bound(lower, intervals.end(), endPPQ, startsAfter);
+        intervals.erase(lower, upper);
+    }
+
+    // Remove intervals that have fully ended before positionPPQ (open notes are kept)
+    void eraseEndingBefore(PPQ positionPPQ)
+    {
+        auto it = std::partition_point(intervals.begin(), intervals.end(), [&](const NoteInterval& note) {
+            return !note.open && note.endPPQ < positionPPQ;
+        });
+        intervals.erase(intervals.begin(), it);
+    }
+
+    // Remove intervals starting after positionPPQ
+    void eraseStartingAfter(PPQ positionPPQ)
+    {
+        auto it = std::upper_bound(intervals.begin(), intervals.end(), positionPPQ, startsAfter);
+        intervals.erase(it, intervals.end());
+    }
+
+private:
+    static bool startsBefore(const NoteInterval& note, PPQ position) { return note.startPPQ < position; }
+    static bool startsAfter(PPQ position, const NoteInterval& note) { return position < note.startPPQ; }
+
+    // Same-pitch notes cannot overlap: the earlier note ends where the next begins
+    void clampToNeighbours(std::vector<NoteInterval>::iterator it)
+    {
+        if (it != intervals.begin())
+        {
+            auto previous = std::prev(it);
+            if (previous->open || previous->endPPQ > it->startPPQ)
+            {
+                previous->open = false;
+                previous->endPPQ = it->startPPQ;
+            }
+        }
+
+        auto next = std::next(it);
+        if (next != intervals.end() && (it->open || it->endPPQ > next->startPPQ))
+        {
+            it->open = false;
+            it->endPPQ = next->startPPQ;
+        }
+    }
+
+    std::vector<NoteInterval> intervals;
+};
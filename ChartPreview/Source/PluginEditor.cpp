@@ -17,8 +17,10 @@ ChartPreviewAudioProcessorEditor::ChartPreviewAudioProcessorEditor(ChartPreviewA
     : AudioProcessorEditor(&p),
       state(state),
       audioProcessor(p),
-      midiInterpreter(state, audioProcessor.getNoteStateMapArray(), audioProcessor.getNoteStateMapLock()),
-      highwayRenderer(state, midiInterpreter)
+      renderState(state.createCopy()),
+      midiInterpreter(renderState, audioProcessor.getChartSnapshots()),
+      highwayRenderer(renderState, midiInterpreter),
+      renderWorker([this](const HighwayRenderWorker::FrameRequest& request, float& frameScale) -> juce::Image& { return renderHighway(request, frameScale); })
 {
     // Set up resize constraints
     constrainer.setMinimumSize(minWidth, minHeight);
@@ -32,12 +34,25 @@ ChartPreviewAudioProcessorEditor::ChartPreviewAudioProcessorEditor(ChartPreviewA
     initAssets();
     initMenus();
     loadState();
+    state.addListener(this);
 
-    startTimerHz(60);
+    #ifdef DEBUG
+    // Self-checks registered as juce::UnitTests (e.g. the sprite blitter kernels), once per process
+    static const bool unitTestsRun = []
+    {
+        juce::UnitTestRunner runner;
+        runner.runTestsInCategory("ChartPreview");
+        return true;
+    }();
+    juce::ignoreUnused(unitTestsRun);
+    #endif
 }
 
 ChartPreviewAudioProcessorEditor::~ChartPreviewAudioProcessorEditor()
 {
+    frameScheduler->removeClient(*this);
+    renderWorker.stop();
+    state.removeListener(this);
 }
 
 
@@ -66,13 +81,18 @@ void ChartPreviewAudioProcessorEditor::initMenus()
     drumTypeMenu.addListener(this);
     addAndMakeVisible(drumTypeMenu);
 
-    framerateMenu.addItemList({"15 FPS", "30 FPS", "60 FPS", "120 FPS", "144 FPS"}, 1);
+    framerateMenu.addItemList({"15 FPS", "30 FPS", "60 FPS", "120 FPS", "144 FPS", "Adaptive"}, 1);
     framerateMenu.addListener(this);
     addAndMakeVisible(framerateMenu);
 
     latencyMenu.addItemList({"250ms", "500ms", "750ms", "1000ms", "1500ms"}, 1);
     latencyMenu.addListener(this);
     addAndMakeVisible(latencyMenu);
+
+    // Internal highway resolution; the UI always draws at native resolution
+    renderScaleMenu.addItemList({"Scale 100%", "Scale 75%", "Scale 50%", "Scale Auto"}, 1);
+    renderScaleMenu.addListener(this);
+    addAndMakeVisible(renderScaleMenu);
     
     autoHopoMenu.addItemList(hopoModeLabels, 1);
     autoHopoMenu.addListener(this);
@@ -125,6 +145,14 @@ void ChartPreviewAudioProcessorEditor::initMenus()
     dynamicsToggle.addListener(this);
     addAndMakeVisible(dynamicsToggle);
 
+    renderThreadToggle.setButtonText("Render Thread");
+    renderThreadToggle.addListener(this);
+    addAndMakeVisible(renderThreadToggle);
+
+    parallelRenderToggle.setButtonText("Parallel Render");
+    parallelRenderToggle.addListener(this);
+    addAndMakeVisible(parallelRenderToggle);
+
     #ifdef DEBUG
     // Debug toggle
     debugToggle.setButtonText("Debug");
@@ -146,31 +174,32 @@ void ChartPreviewAudioProcessorEditor::initMenus()
 //==============================================================================
 void ChartPreviewAudioProcessorEditor::paint (juce::Graphics& g)
 {
-    g.drawImage(backgroundImage, getLocalBounds().toFloat());
+    // Static layers, drawn 1:1 from the cached composite
+    float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    bool showReaperLogo = audioProcessor.isReaperHost && audioProcessor.attemptReaperConnection();
+    updateBackgroundLayer(pixelScale, showReaperLogo);
+    g.drawImageTransformed(backgroundLayer, juce::AffineTransform::scale(1.0f / pixelScale));
+    lastPixelScale = pixelScale;
 
-    // Visual feedback for REAPER connection status
-    if (audioProcessor.isReaperHost && audioProcessor.attemptReaperConnection())
-    {
-        // Draw REAPER logo in bottom left corner
-        if (reaperLogo)
-        {
-            const int logoSize = 24;
-            const int margin = 10;
-            juce::Rectangle<float> logoBounds(margin, getHeight() - logoSize - margin, logoSize, logoSize);
-            reaperLogo->drawWithin(g, logoBounds, juce::RectanglePlacement::centred, 0.8f);
-        }
-    }
+    bool isReaperMode = audioProcessor.isReaperHost && audioProcessor.getReaperMidiProvider().isReaperApiAvailable();
 
-    // Draw the track
-    if (isPart(state, Part::DRUMS))
+    // Extrapolate the playhead to the moment this frame is drawn
+    // (the render thread's frame only shows up at the next paint)
+    refreshPlayhead(renderWorker.isRunning() ? getFrameIntervalMs() : 0.0);
+
+    // Draw the highway - delegate to mode-specific rendering
+    if (isReaperMode)
     {
-        g.drawImage(trackDrumImage, juce::Rectangle<float>(0, 0, getWidth(), getHeight()), juce::RectanglePlacement::centred);
+        paintReaperMode(g);
     }
-    else if (isPart(state, Part::GUITAR))
+    else
     {
-        g.drawImage(trackGuitarImage, juce::Rectangle<float>(0, 0, getWidth(), getHeight()), juce::RectanglePlacement::centred);
+        paintStandardMode(g);
     }
+}
 
+void ChartPreviewAudioProcessorEditor::updateControlVisibility()
+{
     // Hit indicators toggle is always visible for both guitar and drums
     drumTypeMenu.setVisible(isPart(state, Part::DRUMS));
     kick2xToggle.setVisible(isPart(state, Part::DRUMS));
@@ -185,16 +214,68 @@ void ChartPreviewAudioProcessorEditor::paint (juce::Graphics& g)
     bool debugMode = debugToggle.getToggleState();
     consoleOutput.setVisible(debugMode);
     clearLogsButton.setVisible(debugMode);
+    audioProcessor.getDebugLogger().enable(DebugTools::LogCategory::Performance, debugMode);
     #endif
+}
 
-    // Draw the highway - delegate to mode-specific rendering
-    if (isReaperMode)
+ChartPreviewAudioProcessorEditor::FrameKey ChartPreviewAudioProcessorEditor::makeFrameKey(float pixelScale)
+{
+    FrameKey key;
+    key.playheadValid = playhead.valid;
+    key.isPlaying = lastPlayingState;
+    key.position = lastKnownPosition.toDouble();
+    key.bpm = playhead.bpm;
+    key.chartVersion = audioProcessor.getChartSnapshots().getLatestVersion();
+    key.tempoVersion = audioProcessor.getMidiProcessor().tempoMapVersion.load();
+    key.settingsVersion = settingsVersion.load();
+    key.width = getWidth();
+    key.height = getHeight();
+    key.pixelScale = pixelScale;
+    key.reaperMode = audioProcessor.isReaperHost && audioProcessor.getReaperMidiProvider().isReaperApiAvailable();
+    return key;
+}
+
+void ChartPreviewAudioProcessorEditor::updateBackgroundLayer(float pixelScale, bool showReaperLogo)
+{
+    int part = (int)state.getProperty("part");
+    const int layerWidth = juce::jmax(1, juce::roundToInt(getWidth() * pixelScale));
+    const int layerHeight = juce::jmax(1, juce::roundToInt(getHeight() * pixelScale));
+
+    if (backgroundLayer.getWidth() == layerWidth && backgroundLayer.getHeight() == layerHeight &&
+        backgroundLayerScale == pixelScale && backgroundLayerPart == part && backgroundLayerShowsLogo == showReaperLogo)
+        return;
+
+    backgroundLayer = juce::Image(juce::Image::ARGB, layerWidth, layerHeight, true);
+    backgroundLayerScale = pixelScale;
+    backgroundLayerPart = part;
+    backgroundLayerShowsLogo = showReaperLogo;
+
+    juce::Graphics g(backgroundLayer);
+    g.addTransform(juce::AffineTransform::scale(pixelScale));
+
+    g.drawImage(backgroundImage, getLocalBounds().toFloat());
+
+    // Visual feedback for REAPER connection status
+    if (showReaperLogo)
     {
-        paintReaperMode(g);
+        // Draw REAPER logo in bottom left corner
+        if (reaperLogo)
+        {
+            const int logoSize = 24;
+            const int margin = 10;
+            juce::Rectangle<float> logoBounds(margin, getHeight() - logoSize - margin, logoSize, logoSize);
+            reaperLogo->drawWithin(g, logoBounds, juce::RectanglePlacement::centred, 0.8f);
+        }
     }
-    else
+
+    // Draw the track
+    if (isPart(state, Part::DRUMS))
     {
-        paintStandardMode(g);
+        g.drawImage(trackDrumImage, juce::Rectangle<float>(0, 0, getWidth(), getHeight()), juce::RectanglePlacement::centred);
+    }
+    else if (isPart(state, Part::GUITAR))
+    {
+        g.drawImage(trackGuitarImage, juce::Rectangle<float>(0, 0, getWidth(), getHeight()), juce::RectanglePlacement::centred);
     }
 }
 
@@ -207,56 +288,165 @@ void ChartPreviewAudioProcessorEditor::paintReaperMode(juce::Graphics& g)
     // Positive offset = MORE delay (notes appear higher/further from strikeline)
     // Negative offset = LESS delay (notes appear lower/closer to strikeline)
     int latencyOffsetMs = (int)state.getProperty("latencyOffsetMs");
-    if (audioProcessor.getPlayHead())
+    if (playhead.valid)
     {
-        auto positionInfo = audioProcessor.getPlayHead()->getPosition();
-        if (positionInfo.hasValue())
-        {
-            double bpm = positionInfo->getBpm().orFallback(120.0);
-            double latencyOffsetSeconds = latencyOffsetMs / 1000.0;
-            double latencyOffsetBeats = latencyOffsetSeconds * (bpm / 60.0);
-            // Subtract to shift display backward (positive offset = see more future notes)
-            trackWindowStartPPQ = trackWindowStartPPQ - PPQ(latencyOffsetBeats);
-        }
+        double bpm = playhead.bpm > 0.0 ? playhead.bpm : 120.0;
+        double latencyOffsetSeconds = latencyOffsetMs / 1000.0;
+        double latencyOffsetBeats = latencyOffsetSeconds * (bpm / 60.0);
+        // Subtract to shift display backward (positive offset = see more future notes)
+        trackWindowStartPPQ = trackWindowStartPPQ - PPQ(latencyOffsetBeats);
     }
 
-    PPQ trackWindowEndPPQ = trackWindowStartPPQ + displaySizeInPPQ;
     PPQ latencyBufferEnd = trackWindowStartPPQ; // No latency in REAPER mode
 
-    // Extend window for notes behind cursor
-    PPQ extendedStart = trackWindowStartPPQ - displaySizeInPPQ;
+    // REAPER's tempo map is compiled locally by the render pipeline (handles ALL tempo changes, no host calls per element)
+    PPQ cursorPPQ = trackWindowStartPPQ;  // Cursor is at the strikeline
+    paintTimeline(g, cursorPPQ, latencyBufferEnd, playhead.bpm);
+}
+
+void ChartPreviewAudioProcessorEditor::syncTempoMap(double fallbackBPM)
+{
+    if (fallbackBPM <= 0.0) fallbackBPM = 120.0;
+
+    // Copy under the lock only when the tempo events changed since the last compile
+    auto& midiProcessor = audioProcessor.getMidiProcessor();
+    {
+        const juce::ScopedLock lock(midiProcessor.tempoTimeSignatureMapLock);
+        bool usesFallback = midiProcessor.tempoTimeSignatureMap.empty();
+        if (midiProcessor.tempoMapVersion == tempoMapVersion &&
+            (!usesFallback || fallbackBPM == tempoMapFallbackBPM))
+            return;
+
+        tempoTimeSigMapCopy = midiProcessor.tempoTimeSignatureMap;
+        tempoMapVersion = midiProcessor.tempoMapVersion.load();
+    }
 
-    // Generate PPQ-based windows from MidiInterpreter
-    TrackWindow ppqTrackWindow = midiInterpreter.generateTrackWindow(extendedStart, trackWindowEndPPQ);
-    SustainWindow ppqSustainWindow = midiInterpreter.generateSustainWindow(extendedStart, trackWindowEndPPQ, latencyBufferEnd);
+    // No tempo map from the host: constant tempo from the playhead, 4/4
+    if (tempoTimeSigMapCopy.empty())
+        tempoTimeSigMapCopy[PPQ(0.0)] = TempoTimeSignatureEvent(PPQ(0.0), fallbackBPM, 4, 4);
+    tempoMapFallbackBPM = fallbackBPM;
 
-    // Create a lambda that uses REAPER's timeline conversion (handles ALL tempo changes)
-    auto& reaperProvider = audioProcessor.getReaperMidiProvider();
-    auto ppqToTime = [&reaperProvider](double ppq) { return reaperProvider.ppqToTime(ppq); };
+    tempoMap.build(tempoTimeSigMapCopy);
+    tempoMapBuildCount++;
+}
 
-    // Get tempo/timesig map from MidiProcessor (make a copy to avoid holding lock)
-    TempoTimeSignatureMap tempoTimeSigMap;
+void ChartPreviewAudioProcessorEditor::paintTimeline(juce::Graphics& g, PPQ cursorPPQ, PPQ latencyBufferEnd, double fallbackBPM)
+{
+    HighwayRenderWorker::FrameRequest request;
+    request.cursorPPQ = cursorPPQ;
+    request.latencyBufferEnd = latencyBufferEnd;
+    request.windowTimeSeconds = displayWindowTimeSeconds;
+    request.fallbackBPM = fallbackBPM;
+    request.isPlaying = lastPlayingState;
+    request.width = getWidth();
+    request.height = getHeight();
+    request.pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (renderStateDirty.exchange(false))
+        request.settings = state.createCopy();
+
+    if (renderWorker.isRunning())
     {
-        const juce::ScopedLock lock(audioProcessor.getMidiProcessor().tempoTimeSignatureMapLock);
-        tempoTimeSigMap = audioProcessor.getMidiProcessor().tempoTimeSignatureMap;
+        // Show the newest finished frame; this request is rendered in the background
+        // unless the last one sent already covers it
+        FrameKey frameKey = makeFrameKey(request.pixelScale);
+        if (frameKey != lastSubmittedFrameKey || request.settings.isValid())
+        {
+            renderWorker.submit(std::move(request));
+            lastSubmittedFrameKey = frameKey;
+        }
+
+        displayedWorkerFrame = renderWorker.getCompletedFrameCount();
+        renderWorker.drawLatestFrame(g);
+        return;
     }
 
-    // Convert everything to time-based (seconds from cursor)
-    PPQ cursorPPQ = trackWindowStartPPQ;  // Cursor is at the strikeline
-    TimeBasedTrackWindow timeTrackWindow = TimeConverter::convertTrackWindow(ppqTrackWindow, cursorPPQ, ppqToTime);
-    TimeBasedSustainWindow timeSustainWindow = TimeConverter::convertSustainWindow(ppqSustainWindow, cursorPPQ, ppqToTime);
+    float frameScale = request.pixelScale;
+    juce::Image& frame = renderHighway(request, frameScale);
+    g.drawImageTransformed(frame, juce::AffineTransform::scale(1.0f / frameScale));
+}
+
+juce::Image& ChartPreviewAudioProcessorEditor::renderHighway(const HighwayRenderWorker::FrameRequest& request, float& frameScale)
+{
+    if (request.settings.isValid())
+        renderState.copyPropertiesFrom(request.settings, nullptr);
 
-    // Generate gridlines on-the-fly from tempo/timesig map
-    TimeBasedGridlineMap timeGridlineMap = GridlineGenerator::generateGridlines(
-        tempoTimeSigMap, extendedStart, trackWindowEndPPQ, cursorPPQ, ppqToTime);
+    // Compiled locally (no host calls per element), only when the tempo events changed
+    syncTempoMap(request.fallbackBPM);
+
+    // Recompiles only if notes, tempo or settings changed; otherwise this frame is a slice
+    chartTimeline.update(midiInterpreter, tempoTimeSigMapCopy, tempoMap, tempoMapBuildCount, renderState);
 
     // Use the constant time window from the slider (in seconds)
     // Window is anchored at the strikeline (time 0), extending forward into the future
     double windowStartTime = 0.0;
-    double windowEndTime = displayWindowTimeSeconds;
+    double windowEndTime = request.windowTimeSeconds;
+
+    // Last frame's containers are gone, so its arena memory can be handed out again
+    frameArena.reset();
+    #ifdef DEBUG
+    // The logger is not thread-safe, so only report from the message thread
+    if (juce::MessageManager::existsAndIsCurrentThread())
+        reportFrameArenaStats();
+    #endif
+
+    // Reach behind the cursor only as far as hit detection looks (one frame gap); sustains
+    // and lanes crossing the strikeline are found by overlap regardless
+    TimeBasedTrackWindow timeTrackWindow { TimeBasedTrackWindow::allocator_type(&frameArena) };
+    TimeBasedSustainWindow timeSustainWindow { TimeBasedSustainWindow::allocator_type(&frameArena) };
+    TimeBasedGridlineMap timeGridlineMap { TimeBasedGridlineMap::allocator_type(&frameArena) };
+    chartTimeline.slice(request.cursorPPQ, windowStartTime - AnimationRenderer::MAX_CROSSING_GAP_SECONDS, windowEndTime, request.latencyBufferEnd,
+                        timeTrackWindow, timeSustainWindow, timeGridlineMap);
+
+    double cursorTime = tempoMap.qnToTime(request.cursorPPQ.toDouble());
+    juce::Image& frame = highwayRenderer.render((uint)request.width, (uint)request.height, request.pixelScale,
+                                                timeTrackWindow, timeSustainWindow, timeGridlineMap, windowStartTime, windowEndTime,
+                                                cursorTime, request.isPlaying);
+    frameScale = highwayRenderer.getFrameScale();
+    return frame;
+}
+
+void ChartPreviewAudioProcessorEditor::updateRenderWorker()
+{
+    // The next frame is sent to the worker (or drawn here) whatever the last one was
+    lastSubmittedFrameKey = {};
+    lastFrameKey = {};
+
+    if ((bool)state["renderThread"])
+        renderWorker.start();
+    else
+    {
+        // A request dropped by stop() may have carried settings; resend them with the next frame
+        renderWorker.stop();
+        renderStateDirty = true;
+    }
+}
+
+#ifdef DEBUG
+void ChartPreviewAudioProcessorEditor::reportFrameArenaStats()
+{
+    const auto& stats = frameArena.getLastFrameStats();
+    arenaReport.frames++;
+    arenaReport.allocations += stats.allocations;
+    arenaReport.bytes += stats.bytes;
+    arenaReport.heapAllocations += stats.heapAllocations;
+
+    double nowMs = juce::Time::getMillisecondCounterHiRes();
+    if (nowMs - arenaReport.startMs < 1000.0)
+        return;
 
-    highwayRenderer.paint(g, timeTrackWindow, timeSustainWindow, timeGridlineMap, windowStartTime, windowEndTime, audioProcessor.isPlaying);
+    if (arenaReport.frames > 0)
+    {
+        audioProcessor.getDebugLogger().log(DebugTools::LogCategory::Performance,
+            "Frame arena: " + juce::String(arenaReport.allocations / arenaReport.frames) + " allocs, "
+            + juce::String(arenaReport.bytes / arenaReport.frames / 1024) + " KB per frame, "
+            + juce::String(arenaReport.heapAllocations) + " heap blocks over " + juce::String(arenaReport.frames)
+            + " frames (capacity " + juce::String(frameArena.getCapacity() / 1024) + " KB)");
+    }
+
+    arenaReport = {};
+    arenaReport.startMs = nowMs;
 }
+#endif
 
 void ChartPreviewAudioProcessorEditor::paintStandardMode(juce::Graphics& g)
 {
@@ -264,7 +454,7 @@ void ChartPreviewAudioProcessorEditor::paintStandardMode(juce::Graphics& g)
     PPQ trackWindowStartPPQ = lastKnownPosition;
 
     // Apply latency compensation when playing
-    if (audioProcessor.isPlaying)
+    if (lastPlayingState)
     {
         // Use smoothed tempo-aware latency to prevent jitter during tempo changes
         PPQ smoothedLatency = smoothedLatencyInPPQ();
@@ -274,17 +464,13 @@ void ChartPreviewAudioProcessorEditor::paintStandardMode(juce::Graphics& g)
     // Apply latency offset to shift display position (positive only for standard mode)
     // Positive offset = MORE delay (notes appear higher/further from strikeline)
     int latencyOffsetMs = std::max(0, (int)state.getProperty("latencyOffsetMs"));
-    if (audioProcessor.getPlayHead())
+    if (playhead.valid)
     {
-        auto positionInfo = audioProcessor.getPlayHead()->getPosition();
-        if (positionInfo.hasValue())
-        {
-            double bpm = positionInfo->getBpm().orFallback(120.0);
-            double latencyOffsetSeconds = latencyOffsetMs / 1000.0;
-            double latencyOffsetBeats = latencyOffsetSeconds * (bpm / 60.0);
-            // Subtract to shift display backward (positive offset = see more future notes)
-            trackWindowStartPPQ = trackWindowStartPPQ - PPQ(latencyOffsetBeats);
-        }
+        double bpm = playhead.bpm > 0.0 ? playhead.bpm : 120.0;
+        double latencyOffsetSeconds = latencyOffsetMs / 1000.0;
+        double latencyOffsetBeats = latencyOffsetSeconds * (bpm / 60.0);
+        // Subtract to shift display backward (positive offset = see more future notes)
+        trackWindowStartPPQ = trackWindowStartPPQ - PPQ(latencyOffsetBeats);
     }
 
     PPQ trackWindowEndPPQ = trackWindowStartPPQ + displaySizeInPPQ;
@@ -294,57 +480,17 @@ void ChartPreviewAudioProcessorEditor::paintStandardMode(juce::Graphics& g)
     audioProcessor.setMidiProcessorVisualWindowBounds(trackWindowStartPPQ, trackWindowEndPPQ);
 
     // In non-REAPER mode, use current BPM from playhead (no tempo map available)
-    double currentBPM = 120.0;
-    if (audioProcessor.getPlayHead())
-    {
-        auto positionInfo = audioProcessor.getPlayHead()->getPosition();
-        if (positionInfo.hasValue())
-        {
-            currentBPM = positionInfo->getBpm().orFallback(120.0);
-        }
-    }
-
-    // Extend window for notes behind cursor
-    PPQ extendedStart = trackWindowStartPPQ - displaySizeInPPQ;
-
-    // Generate PPQ-based windows from MidiInterpreter
-    TrackWindow ppqTrackWindow = midiInterpreter.generateTrackWindow(extendedStart, trackWindowEndPPQ);
-    SustainWindow ppqSustainWindow = midiInterpreter.generateSustainWindow(extendedStart, trackWindowEndPPQ, latencyBufferEnd);
-
-    // Simple constant BPM conversion for non-REAPER mode
-    auto ppqToTime = [currentBPM](double ppq) { return ppq * (60.0 / currentBPM); };
+    double currentBPM = (playhead.valid && playhead.bpm > 0.0) ? playhead.bpm : 120.0;
 
-    // Create a simple tempo/timesig map for standard mode (default 120 BPM, 4/4)
-    TempoTimeSignatureMap tempoTimeSigMap;
-    {
-        const juce::ScopedLock lock(audioProcessor.getMidiProcessor().tempoTimeSignatureMapLock);
-        tempoTimeSigMap = audioProcessor.getMidiProcessor().tempoTimeSignatureMap;
-
-        // If empty, add a default 4/4, currentBPM event at the start
-        if (tempoTimeSigMap.empty()) {
-            tempoTimeSigMap[PPQ(0.0)] = TempoTimeSignatureEvent(PPQ(0.0), currentBPM, 4, 4);
-        }
-    }
-
-    // Convert everything to time-based (seconds from cursor)
     PPQ cursorPPQ = trackWindowStartPPQ;
-    TimeBasedTrackWindow timeTrackWindow = TimeConverter::convertTrackWindow(ppqTrackWindow, cursorPPQ, ppqToTime);
-    TimeBasedSustainWindow timeSustainWindow = TimeConverter::convertSustainWindow(ppqSustainWindow, cursorPPQ, ppqToTime);
-
-    // Generate gridlines on-the-fly from tempo/timesig map
-    TimeBasedGridlineMap timeGridlineMap = GridlineGenerator::generateGridlines(
-        tempoTimeSigMap, extendedStart, trackWindowEndPPQ, cursorPPQ, ppqToTime);
-
-    // Use the constant time window from the slider (in seconds)
-    // Window is anchored at the strikeline (time 0), extending forward into the future
-    double windowStartTime = 0.0;
-    double windowEndTime = displayWindowTimeSeconds;
-
-    highwayRenderer.paint(g, timeTrackWindow, timeSustainWindow, timeGridlineMap, windowStartTime, windowEndTime, audioProcessor.isPlaying);
+    paintTimeline(g, cursorPPQ, latencyBufferEnd, currentBPM);
 }
 
 void ChartPreviewAudioProcessorEditor::resized()
 {
+    // Static layers are recomposited at the new size on the next paint
+    backgroundLayer = {};
+
     // Keep original control sizes but use responsive positioning
     const int controlWidth = 100;
     const int controlHeight = 20;
@@ -363,6 +509,9 @@ void ChartPreviewAudioProcessorEditor::resized()
     starPowerToggle.setBounds(getWidth() - 120, 35, controlWidth, controlHeight);
     kick2xToggle.setBounds(getWidth() - 120, 60, controlWidth, controlHeight);
     dynamicsToggle.setBounds(getWidth() - 120, 85, controlWidth, controlHeight);
+    renderThreadToggle.setBounds(getWidth() - 120, 110, controlWidth, controlHeight);
+    parallelRenderToggle.setBounds(getWidth() - 120, 135, controlWidth, controlHeight);
+    renderScaleMenu.setBounds(getWidth() - 120, 160, controlWidth, controlHeight);
 
     // Bottom right controls (anchored to bottom-right corner)
     framerateMenu.setBounds(getWidth() - 120, getHeight() - 30, controlWidth, controlHeight);
@@ -406,6 +555,7 @@ void ChartPreviewAudioProcessorEditor::loadState()
     framerateMenu.setSelectedId((int)state["framerate"], juce::dontSendNotification);
     latencyMenu.setSelectedId((int)state["latency"], juce::dontSendNotification);
     autoHopoMenu.setSelectedId((int)state["autoHopo"], juce::dontSendNotification);
+    renderScaleMenu.setSelectedId((int)state["renderScale"], juce::dontSendNotification);
 
     // Load latency offset
     int latencyOffsetMs = (int)state["latencyOffsetMs"];
@@ -415,19 +565,32 @@ void ChartPreviewAudioProcessorEditor::loadState()
     starPowerToggle.setToggleState((bool)state["starPower"], juce::dontSendNotification);
     kick2xToggle.setToggleState((bool)state["kick2x"], juce::dontSendNotification);
     dynamicsToggle.setToggleState((bool)state["dynamics"], juce::dontSendNotification);
+    renderThreadToggle.setToggleState((bool)state["renderThread"], juce::dontSendNotification);
+    parallelRenderToggle.setToggleState((bool)state["parallelRender"], juce::dontSendNotification);
 
     chartSpeedSlider.setValue((double)state["speedTime"], juce::dontSendNotification);
 
     // Apply side-effects that your listeners would normally do
     applyLatencySetting((int)state["latency"]);
-    int fr = ((int)state["framerate"] == 1) ? 15 :
-             ((int)state["framerate"] == 2) ? 30 :
-             ((int)state["framerate"] == 3) ? 60 :
-             ((int)state["framerate"] == 4) ? 120 :
-             ((int)state["framerate"] == 5) ? 144 : 60;
-    startTimerHz(fr);
+    applyFramerateSetting((int)state["framerate"]);
 
     updateDisplaySizeFromSpeedSlider();
+    updateRenderWorker();
+    updateControlVisibility();
+}
+
+void ChartPreviewAudioProcessorEditor::applyFramerateSetting(int framerateValue)
+{
+    adaptiveFramerate = false;
+    switch (framerateValue) {
+    case 1: setFramerate(15); break;
+    case 2: setFramerate(30); break;
+    case 3: setFramerate(60); break;
+    case 4: setFramerate(120); break;
+    case 5: setFramerate(144); break;
+    case 6: adaptiveFramerate = true; updateAdaptiveFramerate(true); break;
+    default: setFramerate(60); break;
+    }
 }
 
 void ChartPreviewAudioProcessorEditor::applyLatencySetting(int latencyValue)
@@ -12,9 +12,14 @@
 #include "PluginProcessor.h"
 #include "Midi/Processing/MidiInterpreter.h"
 #include "Visual/Renderers/HighwayRenderer.h"
+#include "Visual/Renderers/HighwayRenderWorker.h"
 #include "Visual/Managers/GridlineGenerator.h"
 #include "Utils/Utils.h"
 #include "Utils/TimeConverter.h"
+#include "Utils/TempoMap.h"
+#include "Utils/FrameArena.h"
+#include "Visual/Managers/ChartTimeline.h"
+#include "Visual/Managers/FrameScheduler.h"
 
 //==============================================================================
 /**
@@ -25,48 +30,57 @@ class ChartPreviewAudioProcessorEditor  :
     private juce::Slider::Listener,
     private juce::ToggleButton::Listener,
     private juce::TextEditor::Listener,
-    private juce::Timer
+    private juce::ValueTree::Listener,
+    private FrameScheduler::Client
 {
 public:
     ChartPreviewAudioProcessorEditor (ChartPreviewAudioProcessor&, juce::ValueTree &state);
     ~ChartPreviewAudioProcessorEditor() override;
 
     //==============================================================================
-    void timerCallback() override
+    // Called by the shared frame scheduler at the current frame rate
+    void frameTick() override
     {
         printCallback();
 
         bool isReaperMode = audioProcessor.isReaperHost && audioProcessor.getReaperMidiProvider().isReaperApiAvailable();
 
-        // Track position changes for render logic
-        if (auto* playHead = audioProcessor.getPlayHead()) {
-            auto positionInfo = playHead->getPosition();
-            if (positionInfo.hasValue()) {
-                PPQ currentPosition = PPQ(positionInfo->getPpqPosition().orFallback(0.0));
-                bool isCurrentlyPlaying = positionInfo->getIsPlaying();
-
-                // Update tracked position and playing state
-                lastKnownPosition = currentPosition;
-                lastPlayingState = isCurrentlyPlaying;
-
-                // In REAPER mode, throttled cache invalidation while paused to pick up MIDI edits in real-time
-                // Throttled to ~20 Hz (every 3 frames at 60 FPS) to keep responsiveness without overwhelming the host
-                if (isReaperMode && !isCurrentlyPlaying)
-                {
-                    paused_frameCounterSinceLastInvalidation++;
-                    if (paused_frameCounterSinceLastInvalidation >= 3)
-                    {
-                        paused_frameCounterSinceLastInvalidation = 0;
-                        audioProcessor.invalidateReaperCache();
-                    }
-                }
-                else
+        // Track position changes for render logic (paint() refreshes again at draw time)
+        refreshPlayhead();
+        if (playhead.valid) {
+            // In REAPER mode, throttled polling picks up MIDI and tempo edits in real-time, playing or paused.
+            // All REAPER fetching happens here on the message thread; the audio thread only tracks the playhead.
+            // Throttled to ~20 Hz whatever the frame rate; only re-fetches when something changed
+            if (isReaperMode)
+            {
+                double nowMs = juce::Time::getMillisecondCounterHiRes();
+                if (nowMs - lastReaperPollMs >= REAPER_POLL_INTERVAL_MS)
                 {
-                    paused_frameCounterSinceLastInvalidation = 0;  // Reset when playing
+                    lastReaperPollMs = nowMs;
+                    audioProcessor.pollReaperMidiChanges();
                 }
             }
         }
 
+        // The audio thread only edits the working note state; the copy for the renderer is made here
+        audioProcessor.publishChartSnapshot();
+
+        // Skip the repaint when nothing that reaches the screen changed (e.g. paused and idle)
+        FrameKey frameKey = makeFrameKey(lastPixelScale);
+        if (frameKey.settingsVersion != lastFrameKey.settingsVersion || frameKey.reaperMode != lastFrameKey.reaperMode)
+            updateControlVisibility();
+
+        bool workerFrameWaiting = renderWorker.isRunning() && renderWorker.getCompletedFrameCount() != displayedWorkerFrame;
+        bool latencySmoothing = smoothingProgress < 1.0;
+        bool frameChanged = frameKey != lastFrameKey || workerFrameWaiting || latencySmoothing;
+
+        if (adaptiveFramerate)
+            updateAdaptiveFramerate(frameChanged || lastPlayingState);
+
+        if (!frameChanged)
+            return;
+
+        lastFrameKey = frameKey;
         repaint();
     }
 
@@ -82,45 +96,33 @@ public:
 
     void comboBoxChanged(juce::ComboBox *comboBoxThatHasChanged) override
     {
+        // Only settings that change how notes are processed rebuild the note state;
+        // render-only settings are read by the renderer at draw time
+        bool affectsNotes = false;
+
         if (comboBoxThatHasChanged == &skillMenu)
         {
             auto skillValue = skillMenu.getSelectedId();
             state.setProperty("skillLevel", skillValue, nullptr);
+            affectsNotes = true;
         }
         else if (comboBoxThatHasChanged == &partMenu)
         {
             auto partValue = partMenu.getSelectedId();
             state.setProperty("part", partValue, nullptr);
+            affectsNotes = true;
         }
         else if (comboBoxThatHasChanged == &drumTypeMenu)
         {
             auto drumTypeValue = drumTypeMenu.getSelectedId();
             state.setProperty("drumType", drumTypeValue, nullptr);
+            affectsNotes = true;
         }
         else if (comboBoxThatHasChanged == &framerateMenu)
         {
             auto framerateValue = framerateMenu.getSelectedId();
             state.setProperty("framerate", framerateValue, nullptr);
-            int frameRate;
-            switch (framerateValue)
-            {
-            case 1:
-                frameRate = 15;
-                break;
-            case 2:
-                frameRate = 30;
-                break;
-            case 3:
-                frameRate = 60;
-                break;
-            case 4:
-                frameRate = 120;
-                break;
-            case 5:
-                frameRate = 144;
-                break;
-            }
-            startTimerHz(frameRate);
+            applyFramerateSetting(framerateValue);
         }
         else if (comboBoxThatHasChanged == &latencyMenu)
         {
@@ -128,13 +130,20 @@ public:
             state.setProperty("latency", latencyValue, nullptr);
             applyLatencySetting(latencyValue);
         }
+        else if (comboBoxThatHasChanged == &renderScaleMenu)
+        {
+            auto renderScaleValue = renderScaleMenu.getSelectedId();
+            state.setProperty("renderScale", renderScaleValue, nullptr);
+        }
         else if (comboBoxThatHasChanged == &autoHopoMenu)
         {
             auto autoHopoValue = autoHopoMenu.getSelectedId();
             state.setProperty("autoHopo", autoHopoValue, nullptr);
+            affectsNotes = true;
         }
 
-        audioProcessor.refreshMidiDisplay();
+        if (affectsNotes)
+            audioProcessor.refreshMidiDisplay();
     }
 
     void sliderValueChanged(juce::Slider *slider) override
@@ -143,19 +152,14 @@ public:
         {
             state.setProperty("speedTime", slider->getValue(), nullptr);
             updateDisplaySizeFromSpeedSlider();
-
-            // In REAPER mode, invalidate cache to immediately fetch new data window
-            if (audioProcessor.isReaperHost && audioProcessor.getReaperMidiProvider().isReaperApiAvailable())
-            {
-                audioProcessor.invalidateReaperCache();
-            }
-
             repaint();
         }
     }
 
     void buttonClicked(juce::Button * button) override
     {
+        bool affectsNotes = false;
+
         if (button == &hitIndicatorsToggle)
         {
             bool buttonState = button->getToggleState();
@@ -170,18 +174,37 @@ public:
         {
             bool buttonState = button->getToggleState();
             state.setProperty("kick2x", buttonState ? 1 : 0, nullptr);
+            affectsNotes = true;
         }
         else if (button == &dynamicsToggle)
         {
             bool buttonState = button->getToggleState();
             state.setProperty("dynamics", buttonState ? 1 : 0, nullptr);
+            affectsNotes = true;
+        }
+        else if (button == &renderThreadToggle)
+        {
+            bool buttonState = button->getToggleState();
+            state.setProperty("renderThread", buttonState ? 1 : 0, nullptr);
+            updateRenderWorker();
+        }
+        else if (button == &parallelRenderToggle)
+        {
+            bool buttonState = button->getToggleState();
+            state.setProperty("parallelRender", buttonState ? 1 : 0, nullptr);
         }
         else if (button == &clearLogsButton)
         {
             audioProcessor.clearDebugText();
             consoleOutput.clear();
         }
-        audioProcessor.refreshMidiDisplay();
+        else if (button == &debugToggle)
+        {
+            updateControlVisibility();
+        }
+
+        if (affectsNotes)
+            audioProcessor.refreshMidiDisplay();
     }
 
     void textEditorReturnKeyPressed(juce::TextEditor& editor) override
@@ -223,14 +246,8 @@ public:
         if (offsetValue >= minValue && offsetValue <= maxValue)
         {
             state.setProperty("latencyOffsetMs", offsetValue, nullptr);
-            audioProcessor.refreshMidiDisplay();
-
-            // In REAPER mode, invalidate cache to immediately apply offset
-            if (isReaperMode)
-            {
-                audioProcessor.invalidateReaperCache();
-            }
 
+            // The offset only shifts the display window at paint time; the note state is unaffected
             repaint();
         }
         else
@@ -286,33 +303,98 @@ public:
             return;
 
         // Get the current playhead position
-        if (auto* playHead = audioProcessor.getPlayHead())
+        refreshPlayhead();
+        if (playhead.valid)
         {
-            auto positionInfo = playHead->getPosition();
-            if (positionInfo.hasValue())
-            {
-                double currentPPQ = positionInfo->getPpqPosition().orFallback(0.0);
-                double jumpBeats = event.mods.isShiftDown() ? SCROLL_SHIFT_BEATS : SCROLL_NORMAL_BEATS;
+            double currentPPQ = lastKnownPosition.toDouble();
+            double jumpBeats = event.mods.isShiftDown() ? SCROLL_SHIFT_BEATS : SCROLL_NORMAL_BEATS;
 
-                // Note: when shift is held, deltaY might be in deltaX instead
-                double wheelDelta = wheel.deltaY != 0.0 ? wheel.deltaY : wheel.deltaX;
-                double jumpAmount = wheelDelta * jumpBeats;
+            // Note: when shift is held, deltaY might be in deltaX instead
+            double wheelDelta = wheel.deltaY != 0.0 ? wheel.deltaY : wheel.deltaX;
+            double jumpAmount = wheelDelta * jumpBeats;
 
-                double newPPQ = currentPPQ + jumpAmount;
-                newPPQ = std::max(0.0, newPPQ);  // Clamp to 0
+            double newPPQ = currentPPQ + jumpAmount;
+            newPPQ = std::max(0.0, newPPQ);  // Clamp to 0
 
-                audioProcessor.requestTimelinePositionChange(PPQ(newPPQ));
-            }
+            audioProcessor.requestTimelinePositionChange(PPQ(newPPQ));
+            wakeAdaptiveFramerate();
         }
     }
 
+    // Any state change is picked up by the render pipeline's copy at the next frame
+    void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) override { renderStateDirty = true; settingsVersion++; }
+    void valueTreeRedirected(juce::ValueTree&) override { renderStateDirty = true; settingsVersion++; }
+
 private:
     juce::ValueTree& state;
 
     ChartPreviewAudioProcessor& audioProcessor;
+
+    // The render pipeline reads settings from its own copy of the state, refreshed
+    // between frames, so it never reads the tree while the UI is writing it
+    juce::ValueTree renderState;
+    std::atomic<bool> renderStateDirty { false };
+    std::atomic<uint64_t> settingsVersion { 0 };
+
+    // Everything a frame depends on. A frame tick only repaints when it differs from the last
+    // frame's, and the render thread only gets a request when it differs from the last one sent.
+    struct FrameKey
+    {
+        bool playheadValid = false;
+        bool isPlaying = false;
+        double position = 0.0;
+        double bpm = 0.0;
+        uint64_t chartVersion = 0;
+        uint64_t tempoVersion = 0;
+        uint64_t settingsVersion = 0;
+        int width = 0, height = 0;
+        float pixelScale = 0.0f;
+        bool reaperMode = false;
+
+        auto asTuple() const { return std::tie(playheadValid, isPlaying, position, bpm, chartVersion, tempoVersion, settingsVersion, width, height, pixelScale, reaperMode); }
+        bool operator==(const FrameKey& other) const { return asTuple() == other.asTuple(); }
+        bool operator!=(const FrameKey& other) const { return !(*this == other); }
+    };
+    FrameKey makeFrameKey(float pixelScale);
+    FrameKey lastFrameKey;          // Last frame a tick asked for
+    FrameKey lastSubmittedFrameKey; // Last frame sent to the render thread
+    float lastPixelScale = 1.0f;
+    uint64_t displayedWorkerFrame = 0;
+
     MidiInterpreter midiInterpreter;
     HighwayRenderer highwayRenderer;
 
+    // Local copy of the tempo map, recompiled only when the processor's version
+    // (or, without a host tempo map, the playhead tempo) changes
+    TempoTimeSignatureMap tempoTimeSigMapCopy;
+    TempoMap tempoMap;
+    uint64_t tempoMapVersion = UINT64_MAX;
+    uint64_t tempoMapBuildCount = 0;
+    double tempoMapFallbackBPM = 0.0;
+    void syncTempoMap(double fallbackBPM);
+
+    // Song-wide chart in seconds; each frame slices the visible part out of it
+    ChartTimeline chartTimeline;
+
+    // Backs every container that only lives for one paint
+    FrameArena frameArena;
+    #ifdef DEBUG
+    struct
+    {
+        double startMs = 0.0;
+        size_t frames = 0, allocations = 0, bytes = 0, heapAllocations = 0;
+    } arenaReport;
+    void reportFrameArenaStats();
+    #endif
+
+    // Opt-in: renders the pipeline above on a background thread (declared last so it stops first)
+    HighwayRenderWorker renderWorker;
+    void updateRenderWorker();
+    juce::Image& renderHighway(const HighwayRenderWorker::FrameRequest& request, float& frameScale);
+
+    // Share of each frame interval the highway may take before its quality is stepped down
+    static constexpr double HIGHWAY_FRAME_BUDGET_SHARE = 0.5;
+
     //==============================================================================
     // UI Elements
     static constexpr int defaultWidth = 800;
@@ -327,10 +409,19 @@ private:
     juce::Image trackGuitarImage;
     std::unique_ptr<juce::Drawable> reaperLogo;
 
+    // Background, REAPER logo and track composited once at physical resolution;
+    // rebuilt only on resize or when the display scale, part or REAPER connection changes
+    juce::Image backgroundLayer;
+    float backgroundLayerScale = 0.0f;
+    int backgroundLayerPart = 0;
+    bool backgroundLayerShowsLogo = false;
+    void updateBackgroundLayer(float pixelScale, bool showReaperLogo);
+    void updateControlVisibility();
+
     juce::Label chartSpeedLabel;
     juce::Label versionLabel;
     juce::Label latencyOffsetLabel;
-    juce::ComboBox skillMenu, partMenu, drumTypeMenu, framerateMenu, latencyMenu, autoHopoMenu;
+    juce::ComboBox skillMenu, partMenu, drumTypeMenu, framerateMenu, latencyMenu, autoHopoMenu, renderScaleMenu;
 
     // Custom TextEditor that passes arrow keys to parent
     class LatencyOffsetEditor : public juce::TextEditor
@@ -349,7 +440,7 @@ private:
     };
 
     LatencyOffsetEditor latencyOffsetInput;
-    juce::ToggleButton hitIndicatorsToggle, starPowerToggle, kick2xToggle, dynamicsToggle;
+    juce::ToggleButton hitIndicatorsToggle, starPowerToggle, kick2xToggle, dynamicsToggle, renderThreadToggle, parallelRenderToggle;
     juce::Slider chartSpeedSlider;
 
     juce::TextEditor consoleOutput;
@@ -363,9 +454,11 @@ private:
     void loadState();
     void updateDisplaySizeFromSpeedSlider();
     void applyLatencySetting(int latencyValue);
+    void applyFramerateSetting(int framerateValue);
 
     void paintReaperMode(juce::Graphics& g);
     void paintStandardMode(juce::Graphics& g);
+    void paintTimeline(juce::Graphics& g, PPQ cursorPPQ, PPQ latencyBufferEnd, double fallbackBPM);
 
     float latencyInSeconds = 0.0;
     
@@ -376,11 +469,54 @@ private:
     PPQ lastKnownPosition = 0.0;
     bool lastPlayingState = false;
 
+    // Latest playhead published by processBlock; never query the host playhead from the GUI thread.
+    // leadMs extrapolates further ahead, to when the frame will actually be shown.
+    PlayheadState playhead;
+    void refreshPlayhead(double leadMs = 0.0)
+    {
+        playhead = audioProcessor.getPlayheadSnapshot().read();
+        if (!playhead.valid) return;
+
+        lastKnownPosition = PPQ(playhead.extrapolatedPPQ(juce::Time::getMillisecondCounterHiRes() + leadMs));
+        lastPlayingState = playhead.isPlaying;
+    }
+
     PPQ displaySizeInPPQ = 1.5; // Only used for MIDI window fetching
     double displayWindowTimeSeconds = 1.0; // Actual render window time in seconds
 
-    // Cache invalidation throttling (for REAPER MIDI edit detection while paused)
-    int paused_frameCounterSinceLastInvalidation = 0;  // Throttle to ~20 Hz (every 3 frames at 60 FPS)
+    // REAPER MIDI edit detection throttling
+    static constexpr double REAPER_POLL_INTERVAL_MS = 50.0;  // ~20 Hz
+    double lastReaperPollMs = 0.0;
+
+    // Adaptive frame rate: full rate while anything on screen moves, idle rate once it has
+    // been still for a while. Edits and seeks show up as frame changes and ramp straight back up.
+    static constexpr int ADAPTIVE_ACTIVE_FPS = 144;
+    static constexpr int ADAPTIVE_IDLE_FPS = 10;
+    static constexpr double ADAPTIVE_IDLE_DELAY_MS = 1000.0;
+    bool adaptiveFramerate = false;
+    int currentFramerate = 0;
+    double lastActivityMs = 0.0;
+
+    // One vsync-driven clock for every editor in the process, instead of a timer each
+    juce::SharedResourcePointer<FrameScheduler> frameScheduler;
+    double getFrameIntervalMs() const { return currentFramerate > 0 ? 1000.0 / currentFramerate : 0.0; }
+    void setFramerate(int framesPerSecond)
+    {
+        if (framesPerSecond == currentFramerate) return;
+        currentFramerate = framesPerSecond;
+        frameScheduler->setClient(*this, *this, framesPerSecond);
+        highwayRenderer.setFrameBudgetMs(HIGHWAY_FRAME_BUDGET_SHARE * 1000.0 / framesPerSecond);
+    }
+    void updateAdaptiveFramerate(bool active)
+    {
+        double nowMs = juce::Time::getMillisecondCounterHiRes();
+        if (active) lastActivityMs = nowMs;
+        setFramerate(nowMs - lastActivityMs < ADAPTIVE_IDLE_DELAY_MS ? ADAPTIVE_ACTIVE_FPS : ADAPTIVE_IDLE_FPS);
+    }
+    void wakeAdaptiveFramerate()
+    {
+        if (adaptiveFramerate) updateAdaptiveFramerate(true);
+    }
 
     // Scroll wheel timeline control
     static constexpr double SCROLL_NORMAL_BEATS = 2.0;   // Normal scroll: quarter note
@@ -394,12 +530,9 @@ private:
 
     PPQ latencyInPPQ()
     {
-        if (audioProcessor.getPlayHead() == nullptr) return defaultLatencyInPPQ;
-
-        auto positionInfo = audioProcessor.getPlayHead()->getPosition();
-        if (!positionInfo.hasValue()) return defaultLatencyInPPQ;
+        if (!playhead.valid) return defaultLatencyInPPQ;
 
-        double bpm = positionInfo->getBpm().orFallback(defaultBPM);
+        double bpm = playhead.bpm > 0.0 ? playhead.bpm : defaultBPM;
         return PPQ(audioProcessor.latencyInSeconds * (bpm / 60.0));
     }
 
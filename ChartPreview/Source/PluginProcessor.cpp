@@ -58,6 +58,9 @@ void ChartPreviewAudioProcessor::initializeDefaultState()
     state.setProperty("starPower", 1, nullptr);
     state.setProperty("kick2x", 1, nullptr);
     state.setProperty("dynamics", 1, nullptr);
+    state.setProperty("renderThread", 0, nullptr); // Opt-in background highway rendering
+    state.setProperty("parallelRender", 0, nullptr); // Opt-in band-parallel rasterization
+    state.setProperty("renderScale", 1, nullptr); // 100% internal highway resolution
     state.setProperty("speedTime", 1.0, nullptr);
     state.setProperty("reaperTrack", 1, nullptr); // Track 1 (0-indexed) = Track 1 in UI
 }
@@ -94,6 +97,32 @@ void ChartPreviewAudioProcessor::invalidateReaperCache()
             reaperPipeline->refetchAllMidiData();
         }
     }
+
+    midiProcessor.publishSnapshot();
+}
+
+void ChartPreviewAudioProcessor::pollReaperMidiChanges()
+{
+    if (auto* reaperPipeline = dynamic_cast<ReaperMidiPipeline*>(midiPipeline.get()))
+        reaperPipeline->refetchIfChanged();
+
+    midiProcessor.publishSnapshot();
+}
+
+void ChartPreviewAudioProcessor::publishChartSnapshot()
+{
+    midiProcessor.publishSnapshot();
+}
+
+void ChartPreviewAudioProcessor::refreshMidiDisplay()
+{
+    midiProcessor.refreshMidiDisplay();
+
+    // Cached pipelines rebuild their note state with the new settings right here, off the audio thread
+    if (midiPipeline)
+        midiPipeline->invalidateNoteState();
+
+    midiProcessor.publishSnapshot();
 }
 
 void ChartPreviewAudioProcessor::applyTrackNumberChange(int trackNumberZeroBased)
@@ -141,6 +170,13 @@ void ChartPreviewAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     playheadPositionInPPQ = positionInfo->getPpqPosition().orFallback(0.0);
     isPlaying = positionInfo->getIsPlaying();
 
+    auto timeSignature = positionInfo->getTimeSignature().orFallback(juce::AudioPlayHead::TimeSignature());
+    playheadSnapshot.publish(positionInfo->getPpqPosition().orFallback(0.0),
+                             positionInfo->getBpm().orFallback(120.0),
+                             isPlaying,
+                             timeSignature.numerator,
+                             timeSignature.denominator);
+
     // Recreate pipeline if REAPER was just detected
     // NOTE: Must be per-instance, not static! Multiple instances need their own state tracking
     if (isReaperHost != lastReaperConnected)
@@ -203,6 +239,9 @@ void ChartPreviewAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
                                            latencyInSamples,
                                            getSampleRate());
         }
+
+        // Note changes reach the editor through publishChartSnapshot() on the message thread,
+        // so the audio thread never copies the note state
     }
 }
 //==============================================
@@ -391,6 +430,7 @@ void ChartPreviewAudioProcessor::processReaperTimelineMidi(PPQ startPPQ, PPQ end
     {
         // Fallback to old method
         ReaperIntegration::processReaperTimelineMidi(*this, startPPQ, endPPQ, bpm, timeSignatureNumerator, timeSignatureDenominator);
+        midiProcessor.publishSnapshot();
     }
 }
 
@@ -13,6 +13,7 @@
 #include "Midi/Processing/MidiProcessor.h"
 #include "Midi/Providers/REAPER/ReaperMidiProvider.h"
 #include "DebugTools/Logger.h"
+#include "Utils/PlayheadSnapshot.h"
 
 // Forward declarations
 class MidiPipeline;
@@ -33,6 +34,10 @@ public:
     PPQ playheadPositionInPPQ = 0.0;
     bool isPlaying = false;
 
+    // Playhead state for the editor (written in processBlock, read lock-free from the GUI thread)
+    PlayheadSnapshot playheadSnapshot;
+    const PlayheadSnapshot& getPlayheadSnapshot() const { return playheadSnapshot; }
+
     // Cursor position tracking for scrubbing support
     PPQ lastCursorPosition = 0.0;
     bool cursorPositionChanged = false;
@@ -43,11 +48,14 @@ public:
 
     NoteStateMapArray& getNoteStateMapArray() { return midiProcessor.noteStateMapArray; }
     juce::CriticalSection& getNoteStateMapLock() { return midiProcessor.noteStateMapLock; }
+    ChartSnapshotBuffer& getChartSnapshots() { return midiProcessor.chartSnapshots; }
+    void publishChartSnapshot();  // Message thread only: copies pending note changes into a snapshot
 
     // Set visual window bounds for conservative cleanup during tempo changes
     void setMidiProcessorVisualWindowBounds(PPQ startPPQ, PPQ endPPQ) { midiProcessor.setVisualWindowBounds(startPPQ, endPPQ); }
-    void refreshMidiDisplay() { midiProcessor.refreshMidiDisplay(); }
+    void refreshMidiDisplay();
     void invalidateReaperCache();  // Clear cache and force re-fetch (for track changes)
+    void pollReaperMidiChanges();  // Re-fetch only if the track's MIDI or tempo markers changed
     void applyTrackNumberChange(int trackNumberZeroBased);  // Auto-apply track number from VST3 detection
 
     // Debug
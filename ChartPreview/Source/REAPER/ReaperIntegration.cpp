@@ -141,6 +141,7 @@ void ReaperIntegration::processReaperTimelineMidi(
             const juce::ScopedLock lock(midiProcessor.noteStateMapLock);
             midiProcessor.noteStateMapArray[pitch][noteStartPPQ] = NoteData(reaperNote.velocity, Gem::NONE);
             midiProcessor.noteStateMapArray[pitch][noteEndPPQ - PPQ(1)] = NoteData(0, Gem::NONE);
+            midiProcessor.noteIntervalArray[pitch].add(NoteInterval(noteStartPPQ, noteEndPPQ, (uint8_t)pitch, (uint8_t)reaperNote.velocity, Gem::NONE));
         }
 
         if (shouldLog)
@@ -215,9 +216,15 @@ void ReaperIntegration::processReaperTimelineMidi(
         {
             const juce::ScopedLock lock(midiProcessor.noteStateMapLock);
             midiProcessor.noteStateMapArray[noteNumber][noteEndPPQ - PPQ(1)] = NoteData(0, Gem::NONE);
+            midiProcessor.noteIntervalArray[noteNumber].add(NoteInterval(noteStartPPQ, noteEndPPQ, (uint8_t)noteNumber, (uint8_t)velocity, gemType));
         }
     }
 
+    {
+        const juce::ScopedLock lock(midiProcessor.noteStateMapLock);
+        midiProcessor.markNoteDataChanged();
+    }
+
     if (shouldLog)
     {
         processor.print("=== PROCESSING SUMMARY ===");
@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    FrameArena.h
+    Monotonic per-frame allocator for paint temporaries
+
+    Containers that only live for one paint (the visible slice of the chart,
+    the draw call map) allocate from a FrameArena through FrameAllocator.
+    Allocation is a pointer bump, deallocation is a no-op, and reset() hands
+    all memory back at once at the start of the next frame. When a frame
+    outgrows the arena the extra blocks are merged on reset, so after the
+    first few frames a paint makes no heap allocations at all.
+
+    FrameAllocator without an arena falls back to the global heap, and copies
+    of a frame container are always heap-backed so nothing long-lived can
+    point into a reset arena.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t initialCapacity = 64 * 1024)
+    {
+        addBlock(initialCapacity);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment)
+    {
+        #ifdef DEBUG
+        frameStats.allocations++;
+        frameStats.bytes += bytes;
+        #endif
+
+        for (;;)
+        {
+            Block& block = blocks[currentBlock];
+            size_t offset = alignUp(block.used, alignment);
+            if (offset + bytes <= block.size)
+            {
+                block.used = offset + bytes;
+                return block.memory.get() + offset;
+            }
+
+            if (currentBlock + 1 < blocks.size())
+                ++currentBlock;
+            else
+                addBlock(std::max(block.size * 2, bytes + alignment));
+        }
+    }
+
+    // Everything allocated since the last reset becomes invalid.
+    // Containers using the arena must be destroyed or cleared first.
+    void reset()
+    {
+        #ifdef DEBUG
+        lastFrameStats = frameStats;
+        frameStats = {};
+        #endif
+
+        // Merge overflow blocks so the next frame fits in one
+        if (blocks.size() > 1)
+        {
+            size_t total = 0;
+            for (const auto& block : blocks)
+                total += block.size;
+
+            blocks.clear();
+            addBlock(total);
+        }
+
+        for (auto& block : blocks)
+            block.used = 0;
+        currentBlock = 0;
+    }
+
+    size_t getCapacity() const
+    {
+        size_t total = 0;
+        for (const auto& block : blocks)
+            total += block.size;
+        return total;
+    }
+
+    #ifdef DEBUG
+    struct FrameStats
+    {
+        size_t allocations = 0;     // Served from the arena
+        size_t bytes = 0;
+        size_t heapAllocations = 0; // Arena blocks the frame had to allocate
+    };
+
+    // Stats of the last completed frame (updated by reset)
+    const FrameStats& getLastFrameStats() const { return lastFrameStats; }
+    #endif
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size = 0;
+        size_t used = 0;
+    };
+
+    static size_t alignUp(size_t offset, size_t alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    void addBlock(size_t size)
+    {
+        #ifdef DEBUG
+        frameStats.heapAllocations++;
+        #endif
+
+        Block block;
+        block.memory.reset(new std::byte[size]);
+        block.size = size;
+        blocks.push_back(std::move(block));
+        currentBlock = blocks.size() - 1;
+    }
+
+    std::vector<Block> blocks;
+    size_t currentBlock = 0;
+
+    #ifdef DEBUG
+    FrameStats frameStats;
+    FrameStats lastFrameStats;
+    #endif
+};
+
+// Standard allocator over a FrameArena (or the heap when no arena is set)
+template <typename T>
+class FrameAllocator
+{
+public:
+    using value_type = T;
+
+    // Moves and swaps carry the arena along; copies get the heap (see select_on_container_copy_construction)
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    FrameAllocator() noexcept = default;
+    FrameAllocator(FrameArena* frameArena) noexcept : arena(frameArena) {}
+
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : arena(other.getArena()) {}
+
+    T* allocate(size_t count)
+    {
+        if (arena != nullptr)
+            return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept
+    {
+        if (arena == nullptr)
+            ::operator delete(pointer);
+    }
+
+    FrameAllocator select_on_container_copy_construction() const { return FrameAllocator(); }
+
+    FrameArena* getArena() const noexcept { return arena; }
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>& other) const noexcept { return arena == other.getArena(); }
+    template <typename U>
+    bool operator!=(const FrameAllocator<U>& other) const noexcept { return arena != other.getArena(); }
+
+private:
+    FrameArena* arena = nullptr;
+};
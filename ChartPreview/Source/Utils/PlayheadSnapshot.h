@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    PlayheadSnapshot.h
+    Host playhead state published by the audio thread for the editor
+
+    processBlock is the only place the host playhead is guaranteed to be
+    valid, so it stores {ppq, bpm, isPlaying, time signature} together with
+    a high-resolution timestamp under a seqlock. The editor reads a
+    consistent copy without locking or calling into the host, and
+    extrapolates the position forward to the moment it paints.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+
+struct PlayheadState
+{
+    double ppq = 0.0;
+    double bpm = 120.0;
+    bool isPlaying = false;
+    int timeSigNumerator = 4;
+    int timeSigDenominator = 4;
+    double timestampMs = 0.0;       // juce::Time::getMillisecondCounterHiRes() at publish
+    bool valid = false;             // False until the first processBlock
+
+    // Longest stretch we will extrapolate across (host stalled or stopped calling processBlock)
+    static constexpr double MAX_EXTRAPOLATION_MS = 250.0;
+
+    // Playhead position at nowMs, assuming the tempo holds since the last block
+    double extrapolatedPPQ(double nowMs) const
+    {
+        if (!isPlaying) return ppq;
+
+        double elapsedMs = juce::jlimit(0.0, MAX_EXTRAPOLATION_MS, nowMs - timestampMs);
+        return ppq + (elapsedMs / 1000.0) * (bpm / 60.0);
+    }
+};
+
+// Single writer (audio thread), any number of readers
+class PlayheadSnapshot
+{
+public:
+    void publish(double ppq, double bpm, bool isPlaying, int timeSigNumerator, int timeSigDenominator)
+    {
+        const uint32_t start = sequence.load(std::memory_order_relaxed);
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        ppqValue.store(ppq, std::memory_order_relaxed);
+        bpmValue.store(bpm, std::memory_order_relaxed);
+        playingValue.store(isPlaying, std::memory_order_relaxed);
+        numeratorValue.store(timeSigNumerator, std::memory_order_relaxed);
+        denominatorValue.store(timeSigDenominator, std::memory_order_relaxed);
+        timestampValue.store(juce::Time::getMillisecondCounterHiRes(), std::memory_order_relaxed);
+
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    PlayheadState read() const
+    {
+        PlayheadState result;
+        uint32_t before, after;
+        do
+        {
+            before = sequence.load(std::memory_order_acquire);
+
+            result.ppq = ppqValue.load(std::memory_order_relaxed);
+            result.bpm = bpmValue.load(std::memory_order_relaxed);
+            result.isPlaying = playingValue.load(std::memory_order_relaxed);
+            result.timeSigNumerator = numeratorValue.load(std::memory_order_relaxed);
+            result.timeSigDenominator = denominatorValue.load(std::memory_order_relaxed);
+            result.timestampMs = timestampValue.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        result.valid = before != 0;
+        return result;
+    }
+
+private:
+    std::atomic<uint32_t> sequence { 0 };   // Odd while a write is in progress
+    std::atomic<double> ppqValue { 0.0 };
+    std::atomic<double> bpmValue { 120.0 };
+    std::atomic<bool> playingValue { false };
+    std::atomic<int> numeratorValue { 4 };
+    std::atomic<int> denominatorValue { 4 };
+    std::atomic<double> timestampValue { 0.0 };
+};
@@ -0,0 +1,215 @@
+/*
+  ==============================================================================
+
+    TempoMap.h
+    Compiled piecewise tempo map for local QN <-> seconds conversion
+
+    Built once from a TempoTimeSignatureMap whenever the tempo events change.
+    Each tempo event starts a segment holding its absolute start time and
+    tempo; conversions binary search the segment and evaluate it in closed
+    form, so the renderer never has to ask the host per element.
+
+    Segments flagged linearTempo ramp linearly in time from their bpm to the
+    next event's bpm (REAPER's gradual tempo transition). When the host
+    supplied the absolute time of an event it is used as the segment anchor,
+    so rounding never accumulates across the song.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Utils.h"
+
+class TempoMap
+{
+public:
+    TempoMap() = default;
+
+    // Tempo used before the first event and when the map is empty
+    static constexpr double DEFAULT_BPM = 120.0;
+
+    void build(const TempoTimeSignatureMap& tempoTimeSigMap)
+    {
+        segments.clear();
+        startQNs.clear();
+        startTimes.clear();
+        segments.reserve(tempoTimeSigMap.size() + 1);
+
+        double bpm = DEFAULT_BPM;
+        bool linear = false;
+        for (const auto& [ppq, event] : tempoTimeSigMap)
+        {
+            if (event.bpm > 0.0) bpm = event.bpm;
+            linear = event.linearTempo;
+
+            Segment segment;
+            segment.startQN = ppq.toDouble();
+            segment.startBpm = bpm;
+            segment.startTime = event.timeSeconds;
+            segment.linear = linear;
+
+            // Events that only change the time signature don't start a new tempo segment
+            if (!segments.empty() && !segments.back().linear && !linear && segments.back().startBpm == bpm
+                && segment.startTime < 0.0)
+                continue;
+
+            segments.push_back(segment);
+        }
+
+        if (segments.empty() || segments.front().startQN > 0.0)
+        {
+            Segment origin;
+            origin.startQN = 0.0;
+            origin.startTime = 0.0;
+            origin.startBpm = segments.empty() ? DEFAULT_BPM : segments.front().startBpm;
+            segments.insert(segments.begin(), origin);
+        }
+
+        if (segments.front().startTime < 0.0)
+            segments.front().startTime = segments.front().startQN * 60.0 / segments.front().startBpm;
+
+        // Resolve ramps and any start times the host did not supply
+        for (size_t i = 0; i + 1 < segments.size(); i++)
+        {
+            Segment& segment = segments[i];
+            Segment& next = segments[i + 1];
+
+            const double spanQN = next.startQN - segment.startQN;
+            if (next.startTime < 0.0)
+            {
+                // Linear ramp: average tempo over the segment is the mean of both ends
+                const double endBpm = segment.linear ? next.startBpm : segment.startBpm;
+                const double spanTime = spanQN * 120.0 / (segment.startBpm + endBpm);
+                segment.slope = segment.linear ? (endBpm - segment.startBpm) / spanTime : 0.0;
+                next.startTime = segment.startTime + spanTime;
+                continue;
+            }
+
+            // Both ends anchored by the host: fit the segment so it lands exactly on the next event
+            const double spanTime = next.startTime - segment.startTime;
+            if (spanTime <= 0.0 || spanQN <= 0.0)
+                continue;
+
+            if (segment.linear)
+                segment.slope = 2.0 * (60.0 * spanQN - segment.startBpm * spanTime) / (spanTime * spanTime);
+            else
+                segment.startBpm = 60.0 * spanQN / spanTime;
+        }
+
+        startQNs.reserve(segments.size());
+        startTimes.reserve(segments.size());
+        for (const auto& segment : segments)
+        {
+            startQNs.push_back(segment.startQN);
+            startTimes.push_back(segment.startTime);
+        }
+    }
+
+    bool empty() const { return segments.empty(); }
+
+    //==============================================================================
+    // Single conversions - O(log n)
+
+    double qnToTime(double qn) const
+    {
+        if (segments.empty()) return qn * 60.0 / DEFAULT_BPM;
+        return segmentQNToTime(segments[segmentForQN(qn)], qn);
+    }
+
+    double timeToQN(double seconds) const
+    {
+        if (segments.empty()) return seconds * DEFAULT_BPM / 60.0;
+        return segmentTimeToQN(segments[segmentForTime(seconds)], seconds);
+    }
+
+    double bpmAtQN(double qn) const
+    {
+        if (segments.empty()) return DEFAULT_BPM;
+        const Segment& segment = segments[segmentForQN(qn)];
+        return segment.startBpm + segment.slope * (segmentQNToTime(segment, qn) - segment.startTime);
+    }
+
+    //==============================================================================
+    // Batch conversion. Ascending input walks the segments forward instead of
+    // searching, so converting a whole sorted column is O(n + segments).
+
+    void qnToTime(const double* qn, double* seconds, size_t count) const
+    {
+        if (segments.empty())
+        {
+            for (size_t i = 0; i < count; i++)
+                seconds[i] = qn[i] * 60.0 / DEFAULT_BPM;
+            return;
+        }
+
+        size_t index = count > 0 ? segmentForQN(qn[0]) : 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const double value = qn[i];
+            if (value < segments[index].startQN)
+                index = segmentForQN(value);
+            else
+                while (index + 1 < segments.size() && segments[index + 1].startQN <= value)
+                    ++index;
+
+            seconds[i] = segmentQNToTime(segments[index], value);
+        }
+    }
+
+    std::vector<double> qnToTime(const std::vector<double>& qn) const
+    {
+        std::vector<double> seconds(qn.size());
+        qnToTime(qn.data(), seconds.data(), qn.size());
+        return seconds;
+    }
+
+private:
+    struct Segment
+    {
+        double startQN = 0.0;
+        double startTime = -1.0;   // Absolute seconds; negative until resolved
+        double startBpm = DEFAULT_BPM;
+        double slope = 0.0;        // bpm per second, non-zero only for linear ramps
+        bool linear = false;
+    };
+
+    size_t segmentForQN(double qn) const
+    {
+        auto it = std::upper_bound(startQNs.begin(), startQNs.end(), qn);
+        return it == startQNs.begin() ? 0 : (size_t)(it - startQNs.begin()) - 1;
+    }
+
+    size_t segmentForTime(double seconds) const
+    {
+        auto it = std::upper_bound(startTimes.begin(), startTimes.end(), seconds);
+        return it == startTimes.begin() ? 0 : (size_t)(it - startTimes.begin()) - 1;
+    }
+
+    // qn(t) = startQN + (bpm * t + slope * t^2 / 2) / 60, solved for t
+    static double segmentQNToTime(const Segment& segment, double qn)
+    {
+        const double beats = qn - segment.startQN;
+        if (segment.slope == 0.0)
+            return segment.startTime + beats * 60.0 / segment.startBpm;
+
+        // Stable root of slope/2 t^2 + bpm t - 60 beats = 0
+        const double discriminant = segment.startBpm * segment.startBpm + 120.0 * segment.slope * beats;
+        if (discriminant <= 0.0)
+            return segment.startTime + beats * 60.0 / segment.startBpm;
+        return segment.startTime + 120.0 * beats / (segment.startBpm + std::sqrt(discriminant));
+    }
+
+    static double segmentTimeToQN(const Segment& segment, double seconds)
+    {
+        const double t = seconds - segment.startTime;
+        return segment.startQN + (segment.startBpm * t + 0.5 * segment.slope * t * t) / 60.0;
+    }
+
+    std::vector<Segment> segments;
+    std::vector<double> startQNs;
+    std::vector<double> startTimes;
+};
@@ -16,6 +16,7 @@
 #include <JuceHeader.h>
 #include "Utils.h"
 #include "PPQ.h"
+#include "FrameArena.h"
 
 //==============================================================================
 // TEMPO TIME SIGNATURE MAP - Similar structure to NoteStateMap
@@ -24,9 +25,11 @@ using TempoTimeSignatureMap = std::map<PPQ, TempoTimeSignatureEvent>;
 
 //==============================================================================
 // TIME-BASED DATA STRUCTURES (for rendering)
+// Per-frame containers take a FrameAllocator; default-constructed ones use the heap.
 
 using TimeBasedTrackFrame = std::array<GemWrapper, LANE_COUNT>;
-using TimeBasedTrackWindow = std::map<double, TimeBasedTrackFrame>;  // double = seconds from cursor
+using TimeBasedTrackWindow = std::map<double, TimeBasedTrackFrame, std::less<double>,
+                                      FrameAllocator<std::pair<const double, TimeBasedTrackFrame>>>;  // double = seconds from cursor
 
 struct TimeBasedSustainEvent
 {
@@ -37,7 +40,7 @@ struct TimeBasedSustainEvent
     GemWrapper gemType;
 };
 
-using TimeBasedSustainWindow = std::vector<TimeBasedSustainEvent>;
+using TimeBasedSustainWindow = std::vector<TimeBasedSustainEvent, FrameAllocator<TimeBasedSustainEvent>>;
 
 struct TimeBasedGridline
 {
@@ -45,7 +48,7 @@ struct TimeBasedGridline
     Gridline type;
 };
 
-using TimeBasedGridlineMap = std::vector<TimeBasedGridline>;
+using TimeBasedGridlineMap = std::vector<TimeBasedGridline, FrameAllocator<TimeBasedGridline>>;
 
 //==============================================================================
 // TIME CONVERTER
@@ -55,8 +55,6 @@ enum class DrawOrder
     NOTE_ANIMATION
 };
 
-using DrawCallMap = std::map<DrawOrder, std::map<uint, std::vector<std::function<void(juce::Graphics&)>>>>;
-
 //==============================================================================
 // CHART EVENTS
 
@@ -95,6 +93,8 @@ struct TempoTimeSignatureEvent
     int timeSigNumerator;      // Time signature numerator (e.g., 4 in 4/4)
     int timeSigDenominator;    // Time signature denominator (e.g., 4 in 4/4)
     bool timeSigReset;         // True if this event explicitly changed the time signature (reset measure anchor). False if carried forward from previous.
+    double timeSeconds = -1.0; // Absolute time supplied by the host (REAPER), negative when unknown
+    bool linearTempo = false;  // Tempo ramps linearly to the next event's bpm
 
     TempoTimeSignatureEvent()
         : ppqPosition(0.0), bpm(120.0), timeSigNumerator(4), timeSigDenominator(4), timeSigReset(true) {}
@@ -7,7 +7,8 @@
  * Manages hit animations for notes on the strikeline.
  *
  * Each lane can have an active animation (hit flash + flare).
- * Animations play for a fixed number of frames (5 for standard hits, 7 for kicks).
+ * Animations play for a fixed number of frames (5 for standard hits, 7 for kicks),
+ * each shown for a fixed time, so they last as long at any frame rate.
  * If a new note hits before animation completes, it resets to frame 1.
  */
 
@@ -15,6 +16,7 @@ namespace AnimationConstants {
     // Animation frame counts
     static constexpr int HIT_ANIMATION_FRAMES = 5;
     static constexpr int KICK_ANIMATION_FRAMES = 7;
+    static constexpr double ANIMATION_FRAME_SECONDS = 1.0 / 60.0;  // How long each sprite frame shows
 
     // Hit animation rendering parameters
     static constexpr int HIT_FLARE_MAX_FRAME = 3;  // Only show flare for first 3 frames of hit animation
@@ -26,9 +28,11 @@ namespace AnimationConstants {
         bool isOpen = false;   // true for open notes (purple bar flash for guitar)
         bool is2xKick = false; // true for 2x kick (different color)
         bool inSustain = false; // true if currently in a sustain (holds at frame 1)
+        double elapsedSeconds = 0.0; // Time since the note crossed the strikeline
 
         void reset() {
             currentFrame = 0;
+            elapsedSeconds = 0.0;
             isBar = false;
             lane = 0;
             isOpen = false;
@@ -40,28 +44,37 @@ namespace AnimationConstants {
             return currentFrame > 0;
         }
 
-        void advanceFrame() {
+        void advance(double seconds) {
             if (currentFrame == 0) return;
 
             if (inSustain) { // Hold at frame 1 during sustain
                 currentFrame = 1;
+                elapsedSeconds = 0.0;
                 return;
             }
 
-            int maxFrames = isBar ? KICK_ANIMATION_FRAMES : HIT_ANIMATION_FRAMES;
-            currentFrame++;
-            if (currentFrame > maxFrames) {
-                reset();
-            }
+            elapsedSeconds += seconds;
+            updateFrame();
         }
 
-        void trigger(bool bar, int laneIndex, bool open = false, bool twoXKick = false) {
-            currentFrame = 1;  // Start at frame 1
+        // sinceCrossing: how long ago the note reached the strikeline, so a late frame
+        // picks up the animation where it would be by now
+        void trigger(bool bar, int laneIndex, bool open = false, bool twoXKick = false, double sinceCrossing = 0.0) {
             isBar = bar;
             lane = laneIndex;
             isOpen = open;
             is2xKick = twoXKick;
             inSustain = false;
+            elapsedSeconds = std::max(0.0, sinceCrossing);
+            updateFrame();
+        }
+
+        void updateFrame() {
+            int maxFrames = isBar ? KICK_ANIMATION_FRAMES : HIT_ANIMATION_FRAMES;
+            currentFrame = 1 + (int)(elapsedSeconds / ANIMATION_FRAME_SECONDS);
+            if (currentFrame > maxFrames) {
+                reset();
+            }
         }
 
         void setSustainState(bool sustaining) {
@@ -69,6 +82,7 @@ namespace AnimationConstants {
                 inSustain = sustaining;
                 if (inSustain) {
                     currentFrame = 1;  // Reset to frame 1 when entering sustain
+                    elapsedSeconds = 0.0;
                 }
             }
         }
@@ -87,24 +101,24 @@ public:
      * For guitar: gemColumn 0 = open, 1-5 = frets
      * For drums: gemColumn 0 = kick, 1-4 = pads, 6 = 2x kick
      */
-    void triggerHit(int gemColumn, bool isDrums = false, bool is2xKick = false) {
+    void triggerHit(int gemColumn, bool isDrums = false, bool is2xKick = false, double sinceCrossing = 0.0) {
         bool isBar = (gemColumn == 0) || (isDrums && gemColumn == 6);
         int animSlot = isBar ? 0 : gemColumn;
 
         if (animSlot >= 0 && animSlot < animations.size()) {
             bool isOpen = (gemColumn == 0 && !isDrums);  // Only guitar column 0 is "open"
-            animations[animSlot].trigger(isBar, animSlot, isOpen, is2xKick);
+            animations[animSlot].trigger(isBar, animSlot, isOpen, is2xKick, sinceCrossing);
         }
     }
 
     /**
-     * Advance all active animations by one frame.
+     * Advance all active animations by the time since the last call.
      * Call this once per render frame.
      * Animations always advance to allow them to complete when paused.
      */
-    void advanceAllFrames() {
+    void advanceAll(double seconds) {
         for (auto& anim : animations) {
-            anim.advanceFrame();
+            anim.advance(seconds);
         }
     }
 
@@ -103,6 +103,135 @@ void AssetManager::initAssets()
     openAnimationFrames[6] = juce::ImageCache::getFromMemory(BinaryData::hit_open_7_png, BinaryData::hit_open_7_pngSize);
 }
 
+//==============================================================================
+// Pre-scaled sprites
+
+void AssetManager::setSpriteTarget(uint width, uint height, float pixelScale)
+{
+    if (width == spriteTargetWidth && height == spriteTargetHeight && pixelScale == spriteTargetScale)
+        return;
+
+    clearScaledSprites();
+    spriteTargetWidth = width;
+    spriteTargetHeight = height;
+    spriteTargetScale = pixelScale;
+}
+
+void AssetManager::beginSpriteFrame()
+{
+    spriteFrame++;
+
+    // Trim back to three quarters of the budget, so this doesn't run every frame
+    if (scaledSprites.size() > MAX_SCALED_SPRITES)
+        evictLeastRecentlyUsed(MAX_SCALED_SPRITES * 3 / 4);
+
+    if (atlasFull)
+    {
+        atlasFull = false;
+        evictAtlasPage();
+    }
+}
+
+int AssetManager::quantizeSpriteSize(int pixels)
+{
+    // Nearest bucket of the series STEP^n; small sizes map onto themselves
+    static const double logStep = std::log(SPRITE_BUCKET_STEP);
+    double bucket = std::round(std::log((double)pixels) / logStep);
+    return juce::jmax(1, juce::roundToInt(std::exp(bucket * logStep)));
+}
+
+juce::Image* AssetManager::getScaledSprite(const juce::Image* source, int pixelWidth, int pixelHeight)
+{
+    if (source == nullptr || !source->isValid() || pixelWidth <= 0 || pixelHeight <= 0)
+        return nullptr;
+
+    SpriteKey key { source, quantizeSpriteSize(pixelWidth), quantizeSpriteSize(pixelHeight) };
+    auto it = scaledSprites.find(key);
+    if (it != scaledSprites.end())
+    {
+        it->second.lastUsedFrame = spriteFrame;
+        return &it->second.image;
+    }
+
+    juce::Image scaled = source->rescaled(key.width, key.height, juce::Graphics::highResamplingQuality);
+
+    // Move it into the atlas; keep the standalone copy only if the atlas is full. Nothing is
+    // evicted mid-frame: a full atlas frees a page at the next frame start instead.
+    int atlasPage = -1;
+    juce::Image packed = spriteAtlas.add(scaled, atlasPage);
+    if (!packed.isValid())
+    {
+        atlasFull = atlasFull || SpriteAtlas::canHold(scaled);
+        atlasPage = -1;
+        packed = juce::SoftwareImageType().convert(scaled.convertedToFormat(juce::Image::ARGB));
+    }
+
+    return &scaledSprites.emplace(key, ScaledSprite { packed, spriteFrame, atlasPage }).first->second.image;
+}
+
+void AssetManager::evictLeastRecentlyUsed(size_t targetSize)
+{
+    // Runs at frame start, so every variant handed out during the last frame has been drawn
+    std::vector<std::pair<uint64_t, SpriteKey>> byAge;
+    byAge.reserve(scaledSprites.size());
+    for (const auto& [key, sprite] : scaledSprites)
+        byAge.emplace_back(sprite.lastUsedFrame, key);
+
+    size_t excess = scaledSprites.size() - juce::jmin(targetSize, scaledSprites.size());
+    std::nth_element(byAge.begin(), byAge.begin() + (ptrdiff_t)excess, byAge.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (size_t i = 0; i < excess; i++)
+        scaledSprites.erase(byAge[i].second);
+}
+
+void AssetManager::evictAtlasPage()
+{
+    // The page whose newest variant is oldest
+    std::vector<uint64_t> pageLastUsed(spriteAtlas.getPageCount(), 0);
+    for (const auto& [key, sprite] : scaledSprites)
+        if (sprite.atlasPage >= 0)
+            pageLastUsed[(size_t)sprite.atlasPage] = juce::jmax(pageLastUsed[(size_t)sprite.atlasPage], sprite.lastUsedFrame);
+
+    if (pageLastUsed.empty())
+        return;
+
+    int page = (int)(std::min_element(pageLastUsed.begin(), pageLastUsed.end()) - pageLastUsed.begin());
+
+    // Every page was drawn from last frame: the working set is bigger than the atlas, so the
+    // standalone copies stay rather than thrashing pages every frame
+    if (pageLastUsed[(size_t)page] + 1 >= spriteFrame)
+        return;
+
+    for (auto it = scaledSprites.begin(); it != scaledSprites.end();)
+    {
+        if (it->second.atlasPage == page)
+            it = scaledSprites.erase(it);
+        else
+            ++it;
+    }
+    spriteAtlas.resetPage(page);
+
+    // Pack the standalone copies made while the atlas was full into the freed space
+    for (auto& [key, sprite] : scaledSprites)
+    {
+        if (sprite.atlasPage >= 0)
+            continue;
+
+        int atlasPage = -1;
+        juce::Image packed = spriteAtlas.add(sprite.image, atlasPage);
+        if (packed.isValid())
+            sprite = { packed, sprite.lastUsedFrame, atlasPage };
+    }
+}
+
+void AssetManager::clearScaledSprites()
+{
+    scaledSprites.clear();
+    spriteAtlas.clear();
+    atlasFull = false;
+}
+
 juce::Image* AssetManager::getGuitarGlyphImage(const GemWrapper& gemWrapper, uint gemColumn, bool starPowerActive)
 {
     // Use the gem's star power flag to determine if it should be white
@@ -11,7 +11,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <unordered_map>
 #include "../../Utils/Utils.h"
+#include "SpriteAtlas.h"
 
 // Forward declarations
 class MidiInterpreter;
@@ -118,9 +120,75 @@ public:
         return nullptr;
     }
 
+    //==============================================================================
+    // Pre-scaled sprites
+    // A sprite's drawn size depends only on its perspective depth at a given editor
+    // size. Sizes are snapped to a geometric series of buckets (a few percent apart),
+    // so each sprite has a fixed set of depth buckets, and each bucket gets one variant
+    // resampled (once, at high quality). The draw loop blits it 1:1, centred on the
+    // requested rect. Variants live in a shared SpriteAtlas rather than one bitmap each.
+
+    // Drops all variants when the editor size or display scale changes. Variants at other
+    // pixel scales for the same target (the governor's reduced resolution) are just more keys.
+    void setSpriteTarget(uint width, uint height, float pixelScale);
+
+    // Call once per frame before any getScaledSprite(). Evicts least recently used
+    // variants here, so nothing handed out during a frame is dropped before it ends.
+    void beginSpriteFrame();
+
+    // Variant of source for a pixelWidth x pixelHeight rect (physical pixels), or nullptr for
+    // an empty size. The variant is the rect's bucket size, which may differ by a pixel or two.
+    juce::Image* getScaledSprite(const juce::Image* source, int pixelWidth, int pixelHeight);
+
 private:
     void initAssets();
 
+    struct SpriteKey
+    {
+        const juce::Image* source;
+        int width, height;
+
+        bool operator==(const SpriteKey& other) const
+        {
+            return source == other.source && width == other.width && height == other.height;
+        }
+    };
+
+    struct SpriteKeyHash
+    {
+        size_t operator()(const SpriteKey& key) const
+        {
+            size_t hash = std::hash<const void*>()(key.source);
+            hash ^= std::hash<int>()(key.width) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<int>()(key.height) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct ScaledSprite
+    {
+        juce::Image image;
+        uint64_t lastUsedFrame;
+        int atlasPage;          // -1: standalone copy (the atlas was full or it is too big)
+    };
+
+    // Neighbouring buckets differ by this factor; below ~1 / (factor - 1) pixels every size is its own bucket
+    static constexpr double SPRITE_BUCKET_STEP = 1.025;
+    static int quantizeSpriteSize(int pixels);
+
+    // Past this many variants, the least recently used are dropped at the next frame start
+    static constexpr size_t MAX_SCALED_SPRITES = 2048;
+
+    std::unordered_map<SpriteKey, ScaledSprite, SpriteKeyHash> scaledSprites;
+    SpriteAtlas spriteAtlas;
+    uint64_t spriteFrame = 0;
+    bool atlasFull = false;     // A variant missed the atlas this frame; free a page at the next frame start
+    void clearScaledSprites();
+    void evictLeastRecentlyUsed(size_t targetSize);
+    void evictAtlasPage();
+    uint spriteTargetWidth = 0, spriteTargetHeight = 0;
+    float spriteTargetScale = 0.0f;
+
     // Bar/Open notes
     juce::Image barKickImage;
     juce::Image barKick2xImage;
@@ -0,0 +1,220 @@
+/*
+  ==============================================================================
+
+    ChartTimeline.cpp
+    Song-wide, time-domain copy of the chart for rendering
+
+  ==============================================================================
+*/
+
+#include "ChartTimeline.h"
+#include "GridlineGenerator.h"
+#include "../../Midi/Processing/MidiInterpreter.h"
+
+void ChartTimeline::update(MidiInterpreter& midiInterpreter,
+                           const TempoTimeSignatureMap& newTempoTimeSigMap,
+                           const TempoMap& newTempoMap,
+                           uint64_t tempoVersion,
+                           juce::ValueTree& state)
+{
+    tempoTimeSigMap = &newTempoTimeSigMap;
+    tempoMap = &newTempoMap;
+
+    uint64_t chartVersion = midiInterpreter.getChartVersion();
+    int part = (int)state.getProperty("part");
+    int skill = (int)state.getProperty("skillLevel");
+    bool kick2x = (bool)state.getProperty("kick2x");
+
+    if (compiled && compiledChartVersion == chartVersion && compiledTempoVersion == tempoVersion &&
+        compiledPart == part && compiledSkill == skill && compiledKick2x == kick2x)
+        return;
+
+    compile(midiInterpreter);
+
+    compiled = true;
+    compiledChartVersion = chartVersion;
+    compiledTempoVersion = tempoVersion;
+    compiledPart = part;
+    compiledSkill = skill;
+    compiledKick2x = kick2x;
+}
+
+void ChartTimeline::compile(MidiInterpreter& midiInterpreter)
+{
+    const PPQ songStart = PPQ(std::numeric_limits<int64_t>::lowest() / 4);
+    const PPQ songEnd = openEndPPQ();
+
+    TrackWindow trackWindow = midiInterpreter.generateTrackWindow(songStart, songEnd);
+    SustainWindow sustainWindow = midiInterpreter.generateSustainWindow(songStart, songEnd, openEndPPQ());
+
+    lastEventPPQ = PPQ(0.0);
+
+    // New data: window edges from the last frame no longer index anything
+    gemBegin.reset();
+    gemEnd.reset();
+
+    // Gems - the track window is already sorted, so convert its positions as one batch
+    std::vector<double> positions;
+    positions.reserve(trackWindow.size());
+    gemFrames.clear();
+    gemFrames.reserve(trackWindow.size());
+    for (const auto& [position, frame] : trackWindow)
+    {
+        positions.push_back(position.toDouble());
+        gemFrames.push_back(frame);
+        lastEventPPQ = std::max(lastEventPPQ, position);
+    }
+    gemTimes.resize(positions.size());
+    tempoMap->qnToTime(positions.data(), gemTimes.data(), positions.size());
+
+    // Sustains and lanes
+    lanes.clear();
+    sustains.clear();
+    for (const auto& sustain : sustainWindow)
+    {
+        TimedSustain timed;
+        timed.open = sustain.endPPQ >= openEndPPQ();
+        timed.startTime = tempoMap->qnToTime(sustain.startPPQ.toDouble());
+        timed.endTime = timed.open ? std::numeric_limits<double>::max() : tempoMap->qnToTime(sustain.endPPQ.toDouble());
+        timed.gemColumn = sustain.gemColumn;
+        timed.sustainType = sustain.sustainType;
+        timed.gemType = sustain.gemType;
+
+        if (!timed.open)
+            lastEventPPQ = std::max(lastEventPPQ, sustain.endPPQ);
+
+        if (sustain.sustainType == SustainType::SUSTAIN)
+            sustains.add(timed);
+        else
+            lanes.add(timed);
+    }
+    lanes.finalise();
+    sustains.finalise();
+
+    compileGridlines(lastEventPPQ + PPQ(GRIDLINE_LOOKAHEAD_PPQ));
+}
+
+void ChartTimeline::compileGridlines(PPQ endPPQ)
+{
+    // Absolute times: generate against a cursor at 0 and add its time back
+    auto ppqToTime = [this](double ppq) { return tempoMap->qnToTime(ppq); };
+    double originTime = ppqToTime(0.0);
+
+    TimeBasedGridlineMap generated = GridlineGenerator::generateGridlines(
+        *tempoTimeSigMap, PPQ(0.0), endPPQ, PPQ(0.0), ppqToTime);
+
+    gridlineTimes.clear();
+    gridlineTypes.clear();
+    gridlineTimes.reserve(generated.size());
+    gridlineTypes.reserve(generated.size());
+    for (const auto& gridline : generated)
+    {
+        gridlineTimes.push_back(gridline.time + originTime);
+        gridlineTypes.push_back(gridline.type);
+    }
+
+    gridlineEndPPQ = endPPQ;
+    gridBegin.reset();
+    gridEnd.reset();
+}
+
+void ChartTimeline::slice(PPQ cursorPPQ,
+                          double windowStartTime,
+                          double windowEndTime,
+                          PPQ openEndPPQ,
+                          TimeBasedTrackWindow& trackWindow,
+                          TimeBasedSustainWindow& sustainWindow,
+                          TimeBasedGridlineMap& gridlines)
+{
+    if (!compiled) return;
+
+    const double cursorTime = tempoMap->qnToTime(cursorPPQ.toDouble());
+    const double startTime = cursorTime + windowStartTime;
+    const double endTime = cursorTime + windowEndTime;
+
+    // Gems
+    size_t gemFirst = gemBegin.seek(gemTimes, startTime);
+    size_t gemLast = std::max(gemFirst, gemEnd.seek(gemTimes, endTime));
+    for (size_t index = gemFirst; index < gemLast; index++)
+        trackWindow.emplace_hint(trackWindow.end(), gemTimes[index] - cursorTime, gemFrames[index]);
+
+    // Lanes first so sustains draw on top of them
+    const double openEndTime = tempoMap->qnToTime(openEndPPQ.toDouble());
+    lanes.slice(startTime, endTime, cursorTime, openEndTime, sustainWindow);
+    sustains.slice(startTime, endTime, cursorTime, openEndTime, sustainWindow);
+
+    // Gridlines, extending the compiled range when playback runs past it
+    PPQ windowEndPPQ = PPQ(tempoMap->timeToQN(endTime));
+    if (windowEndPPQ >= gridlineEndPPQ)
+        compileGridlines(windowEndPPQ + PPQ(GRIDLINE_LOOKAHEAD_PPQ));
+
+    size_t gridFirst = gridBegin.seek(gridlineTimes, startTime);
+    size_t gridLast = std::max(gridFirst, gridEnd.seek(gridlineTimes, endTime));
+    for (size_t index = gridFirst; index < gridLast; index++)
+        gridlines.push_back({ gridlineTimes[index] - cursorTime, gridlineTypes[index] });
+}
+
+//==============================================================================
+
+size_t ChartTimeline::SlidingBound::seek(const std::vector<double>& times, double value, bool upper)
+{
+    auto before = [value, upper](double time) { return upper ? time <= value : time < value; };
+
+    index = std::min(index, times.size());
+    if (index > 0 && !before(times[index - 1]))
+    {
+        // Moved backwards: the answer is somewhere before the last one
+        index = (size_t)(std::partition_point(times.begin(), times.begin() + (std::ptrdiff_t)index, before) - times.begin());
+        return index;
+    }
+
+    for (size_t steps = 0; index < times.size() && before(times[index]); steps++)
+    {
+        if (steps == MAX_SLIDE_STEPS)
+        {
+            index = (size_t)(std::partition_point(times.begin() + (std::ptrdiff_t)index, times.end(), before) - times.begin());
+            break;
+        }
+        index++;
+    }
+    return index;
+}
+
+//==============================================================================
+
+void ChartTimeline::SustainList::finalise()
+{
+    std::stable_sort(sustains.begin(), sustains.end(), [](const TimedSustain& a, const TimedSustain& b) {
+        return a.startTime < b.startTime;
+    });
+
+    maxEndTimes.resize(sustains.size());
+    double maxEnd = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < sustains.size(); i++)
+    {
+        maxEnd = std::max(maxEnd, sustains[i].endTime);
+        maxEndTimes[i] = maxEnd;
+    }
+}
+
+void ChartTimeline::SustainList::slice(double startTime, double endTime, double cursorTime, double openEndTime,
+                                       TimeBasedSustainWindow& output)
+{
+    // Nothing before the first index whose running max end reaches the window can overlap it
+    for (size_t i = first.seek(maxEndTimes, startTime, true); i < sustains.size(); i++)
+    {
+        const TimedSustain& sustain = sustains[i];
+        if (sustain.startTime >= endTime) break;
+
+        double sustainEnd = sustain.open ? openEndTime : sustain.endTime;
+        if (sustainEnd <= startTime || sustainEnd <= sustain.startTime) continue;
+
+        TimeBasedSustainEvent event;
+        event.startTime = sustain.startTime - cursorTime;
+        event.endTime = sustainEnd - cursorTime;
+        event.gemColumn = sustain.gemColumn;
+        event.sustainType = sustain.sustainType;
+        event.gemType = sustain.gemType;
+        output.push_back(event);
+    }
+}
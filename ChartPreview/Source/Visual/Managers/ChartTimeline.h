@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    ChartTimeline.h
+    Song-wide, time-domain copy of the chart for rendering
+
+    Gems, sustains/lanes and gridlines are compiled once with their absolute
+    time in seconds and kept sorted. The compile only reruns when the note
+    snapshot, the tempo map or the note-mapping settings change; a frame is
+    then a search per window edge plus a cursor-relative offset, so its cost
+    no longer depends on the window length or the tempo map. The edges pick
+    up where the previous frame left them, so during playback the search is
+    a few steps and only a seek pays for a binary search.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <limits>
+#include <vector>
+#include "../../Utils/Utils.h"
+#include "../../Utils/TimeConverter.h"
+#include "../../Utils/TempoMap.h"
+
+class MidiInterpreter;
+
+class ChartTimeline
+{
+public:
+    ChartTimeline() = default;
+
+    // Recompile if the chart, tempo or settings changed since the last call.
+    // Both maps must outlive this timeline (the editor owns all three).
+    void update(MidiInterpreter& midiInterpreter,
+                const TempoTimeSignatureMap& tempoTimeSigMap,
+                const TempoMap& tempoMap,
+                uint64_t tempoVersion,
+                juce::ValueTree& state);
+
+    // Everything visible in [cursor + windowStartTime, cursor + windowEndTime),
+    // with times relative to the cursor. Notes still held extend to openEndPPQ.
+    // The window edges are searched from where the previous slice left them, so
+    // a window sliding forward costs the events that entered or left it.
+    void slice(PPQ cursorPPQ,
+               double windowStartTime,
+               double windowEndTime,
+               PPQ openEndPPQ,
+               TimeBasedTrackWindow& trackWindow,
+               TimeBasedSustainWindow& sustainWindow,
+               TimeBasedGridlineMap& gridlines);
+
+private:
+    // A lower (or upper) bound remembered between frames. Moving forward by a few
+    // events steps to the new answer; seeks and jumps fall back to a binary search.
+    struct SlidingBound
+    {
+        size_t index = 0;
+
+        size_t seek(const std::vector<double>& times, double value, bool upper = false);
+        void reset() { index = 0; }
+    };
+
+    // Linear steps tried before giving up and binary searching the rest
+    static constexpr size_t MAX_SLIDE_STEPS = 32;
+
+    struct TimedSustain
+    {
+        double startTime;
+        double endTime;     // Ignored while open
+        bool open;
+        uint gemColumn;
+        SustainType sustainType;
+        GemWrapper gemType;
+    };
+
+    // Sustains sorted by start, with a running max of their ends for the lower-edge search
+    struct SustainList
+    {
+        std::vector<TimedSustain> sustains;
+        std::vector<double> maxEndTimes;
+        SlidingBound first;
+
+        void clear() { sustains.clear(); maxEndTimes.clear(); first.reset(); }
+        void add(const TimedSustain& sustain) { sustains.push_back(sustain); }
+        void finalise();
+        void slice(double startTime, double endTime, double cursorTime, double openEndTime,
+                   TimeBasedSustainWindow& output);
+    };
+
+    void compile(MidiInterpreter& midiInterpreter);
+    void compileGridlines(PPQ endPPQ);
+
+    // End given to the interpreter for notes without a note-off yet
+    static PPQ openEndPPQ() { return PPQ(std::numeric_limits<int64_t>::max() / 4); }
+
+    // Gridlines are generated this far past what is needed, then extended on demand
+    static constexpr double GRIDLINE_LOOKAHEAD_PPQ = 64.0;
+
+    std::vector<double> gemTimes;
+    std::vector<TimeBasedTrackFrame> gemFrames;
+    SustainList lanes;
+    SustainList sustains;
+    std::vector<double> gridlineTimes;
+    std::vector<Gridline> gridlineTypes;
+    SlidingBound gemBegin, gemEnd, gridBegin, gridEnd;
+    PPQ gridlineEndPPQ = 0.0;
+    PPQ lastEventPPQ = 0.0;
+
+    const TempoTimeSignatureMap* tempoTimeSigMap = nullptr;
+    const TempoMap* tempoMap = nullptr;
+
+    // Compile key
+    bool compiled = false;
+    uint64_t compiledChartVersion = 0;
+    uint64_t compiledTempoVersion = 0;
+    int compiledPart = -1;
+    int compiledSkill = -1;
+    bool compiledKick2x = false;
+};
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    FrameBudgetGovernor.h
+    Steps highway quality down while frames overrun their budget
+
+    The renderer reports what each frame cost. When the smoothed cost stays
+    above the budget, quality drops one level; once it has stayed well under
+    the budget for a while, it climbs back one level at a time. Each level
+    keeps the savings of the levels before it. Stepping down reacts within a
+    few frames, stepping up waits much longer so the two don't oscillate.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+
+class FrameBudgetGovernor
+{
+public:
+    enum class Quality : int
+    {
+        FULL,
+        SIMPLE_SUSTAINS,        // Sustains without caps, filled in coarse rows
+        NO_FAR_OVERLAYS,        // Accent/ghost/tap overlays only on the nearer gems
+        SPARSE_GRIDLINES,       // Half-beat gridlines dropped
+        REDUCED_RESOLUTION      // Highway rasterized below display resolution and upscaled
+    };
+
+    // Time one frame may take; 0 disables the governor (always full quality)
+    void setBudgetMs(double ms) { budgetMs.store(ms); }
+
+    Quality getQuality() const { return quality; }
+    bool isAtLeast(Quality level) const { return quality >= level; }
+
+    // Cost of the frame just rendered
+    void addFrame(double costMs)
+    {
+        averageMs += (costMs - averageMs) * SMOOTHING;
+        framesAtLevel++;
+
+        const double budget = budgetMs.load();
+        if (budget <= 0.0)
+        {
+            setQuality(Quality::FULL);
+            return;
+        }
+
+        if (averageMs > budget && framesAtLevel >= STEP_DOWN_FRAMES && quality != Quality::REDUCED_RESOLUTION)
+            setQuality((Quality)((int)quality + 1));
+        else if (averageMs < budget * HEADROOM && framesAtLevel >= STEP_UP_FRAMES && quality != Quality::FULL)
+            setQuality((Quality)((int)quality - 1));
+    }
+
+private:
+    static constexpr double SMOOTHING = 0.1;        // Weight of the newest frame in the average
+    static constexpr double HEADROOM = 0.6;         // Step up only below this share of the budget
+    static constexpr int STEP_DOWN_FRAMES = 15;
+    static constexpr int STEP_UP_FRAMES = 120;
+
+    void setQuality(Quality level)
+    {
+        if (level == quality) return;
+        quality = level;
+        framesAtLevel = 0;
+    }
+
+    std::atomic<double> budgetMs { 0.0 };   // Set from the message thread
+    Quality quality = Quality::FULL;
+    double averageMs = 0.0;
+    int framesAtLevel = 0;
+};
@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+    FrameScheduler.cpp
+    One display-synchronised frame clock shared by every open editor
+
+  ==============================================================================
+*/
+
+#include "FrameScheduler.h"
+
+FrameScheduler::FrameScheduler()
+{
+    setTimerRate(WATCHDOG_HZ);
+}
+
+FrameScheduler::~FrameScheduler()
+{
+    stopTimer();
+    vblank.reset();
+}
+
+void FrameScheduler::setClient(Client& client, juce::Component& component, int framesPerSecond)
+{
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    const double intervalMs = 1000.0 / juce::jmax(1, framesPerSecond);
+
+    for (auto& entry : entries)
+    {
+        if (entry.client == &client)
+        {
+            entry.component = &component;
+            entry.intervalMs = intervalMs;
+            entry.nextDueMs = juce::jmin(entry.nextDueMs, nowMs + intervalMs);
+            return;
+        }
+    }
+
+    // Each new editor starts one refresh later than the last, so editors at the same
+    // rate land on different refreshes instead of piling onto one
+    double phaseMs = std::fmod(registrations++ * vblankPeriodMs, intervalMs);
+    entries.push_back({ &client, &component, intervalMs, nowMs + phaseMs });
+
+    if (vblankComponent == nullptr)
+        attachToDisplay();
+}
+
+void FrameScheduler::removeClient(Client& client)
+{
+    auto it = std::find_if(entries.begin(), entries.end(), [&client](const Entry& entry) { return entry.client == &client; });
+    if (it == entries.end())
+        return;
+
+    bool wasHost = (it->component == vblankComponent);
+    entries.erase(it);
+
+    if (wasHost)
+        attachToDisplay();
+}
+
+juce::Component* FrameScheduler::findShowingComponent() const
+{
+    auto host = std::find_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.component->isShowing(); });
+    return host != entries.end() ? host->component : nullptr;
+}
+
+void FrameScheduler::attachToDisplay()
+{
+    vblank.reset();
+    vblankComponent = nullptr;
+    if (entries.empty())
+        return;
+
+    // Prefer an editor that is on screen: hidden ones get no vblanks
+    auto* host = findShowingComponent();
+    vblankComponent = host != nullptr ? host : entries.front().component;
+    vblank = std::make_unique<juce::VBlankAttachment>(vblankComponent, [this] { onVBlank(); });
+}
+
+void FrameScheduler::onVBlank()
+{
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+
+    // Track the refresh period; long gaps (window hidden, system busy) are not refreshes
+    if (lastVBlankMs > 0.0)
+    {
+        double periodMs = nowMs - lastVBlankMs;
+        if (periodMs > 1.0 && periodMs < VBLANK_TIMEOUT_MS)
+            vblankPeriodMs += (periodMs - vblankPeriodMs) * 0.1;
+    }
+    lastVBlankMs = nowMs;
+
+    setTimerRate(WATCHDOG_HZ);
+    tick(nowMs);
+}
+
+void FrameScheduler::timerCallback()
+{
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    if (nowMs - lastVBlankMs < VBLANK_TIMEOUT_MS)
+        return;
+
+    // No refreshes: maybe the hosting editor was hidden while another one is visible.
+    // Only move to an editor that is showing; with all of them hidden there is nothing
+    // better to attach to, and rebuilding the attachment every tick would gain nothing.
+    if ((vblankComponent == nullptr || !vblankComponent->isShowing()) && findShowingComponent() != nullptr)
+        attachToDisplay();
+
+    // Tick from the timer at the fastest rate anyone wants until vblanks come back
+    double shortestIntervalMs = 1000.0 / WATCHDOG_HZ;
+    for (const auto& entry : entries)
+        shortestIntervalMs = juce::jmin(shortestIntervalMs, entry.intervalMs);
+    setTimerRate(juce::roundToInt(1000.0 / shortestIntervalMs));
+
+    tick(nowMs);
+}
+
+void FrameScheduler::setTimerRate(int hz)
+{
+    if (hz == timerHz) return;
+    timerHz = hz;
+    startTimerHz(hz);
+}
+
+void FrameScheduler::tick(double nowMs)
+{
+    if (entries.empty())
+        return;
+
+    // Due within half a refresh counts as due now, so a rate equal to the display's never skips
+    const double toleranceMs = vblankPeriodMs * 0.5;
+
+    due.clear();
+    const size_t count = entries.size();
+    rotation = (rotation + 1) % count;
+    for (size_t i = 0; i < count; i++)
+    {
+        Entry& entry = entries[(rotation + i) % count];
+        if (entry.nextDueMs > nowMs + toleranceMs)
+            continue;
+
+        // Keep the phase while on schedule; after a stall start over from now
+        entry.nextDueMs += entry.intervalMs;
+        if (entry.nextDueMs < nowMs)
+            entry.nextDueMs = nowMs + entry.intervalMs;
+
+        due.push_back(entry.client);
+    }
+
+    // A tick may remove or re-rate clients, so only tick those still registered
+    for (Client* client : due)
+    {
+        bool registered = std::any_of(entries.begin(), entries.end(), [client](const Entry& entry) { return entry.client == client; });
+        if (registered)
+            client->frameTick();
+    }
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    FrameScheduler.h
+    One display-synchronised frame clock shared by every open editor
+
+    Instead of a timer per editor, every editor in the process registers
+    here with the frame rate it wants. A single juce::VBlankAttachment
+    (hosted by one of the editors) wakes the scheduler once per display
+    refresh, and each editor is ticked on the refreshes its rate falls on.
+    Editors get spread across refreshes by giving each a different phase,
+    and the order they tick in rotates, so they neither beat against each
+    other nor all repaint on the same refresh.
+
+    A window that is hidden or minimised gets no vblanks. If none arrive
+    for a while, a fallback timer takes over until they resume.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <memory>
+#include <vector>
+
+class FrameScheduler : private juce::Timer
+{
+public:
+    struct Client
+    {
+        virtual ~Client() = default;
+        virtual void frameTick() = 0;
+    };
+
+    FrameScheduler();
+    ~FrameScheduler() override;
+
+    // Ticks the client at framesPerSecond (capped by the display refresh rate); calling
+    // again changes the rate. The component's display drives the refresh.
+    void setClient(Client& client, juce::Component& component, int framesPerSecond);
+    void removeClient(Client& client);
+
+private:
+    struct Entry
+    {
+        Client* client;
+        juce::Component* component;
+        double intervalMs;
+        double nextDueMs;
+    };
+
+    static constexpr double VBLANK_TIMEOUT_MS = 100.0;  // Silence after which the fallback timer ticks
+    static constexpr int WATCHDOG_HZ = 5;               // Fallback timer rate while vblanks arrive
+
+    void attachToDisplay();
+    juce::Component* findShowingComponent() const;
+    void onVBlank();
+    void tick(double nowMs);
+    void timerCallback() override;
+    void setTimerRate(int hz);
+
+    std::vector<Entry> entries;
+    std::vector<Client*> due;
+
+    std::unique_ptr<juce::VBlankAttachment> vblank;
+    juce::Component* vblankComponent = nullptr;
+    double lastVBlankMs = 0.0;
+    double vblankPeriodMs = 1000.0 / 60.0;  // Measured; used for phases and tolerance
+
+    size_t rotation = 0;
+    int registrations = 0;
+    int timerHz = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FrameScheduler)
+};
@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    SpriteAtlas.h
+    Shelf-packed atlas pages for pre-scaled sprites
+
+    Sprites are copied into large shared pages, left to right along shelves,
+    and handed back as juce::Image views of their slot. A view shares the
+    page's pixel data, so drawing it costs the same as drawing a standalone
+    image while every sprite on screen reads from the same few bitmaps.
+
+    Shelves can't free single slots, so space comes back a page at a time:
+    resetPage() gives a page fresh pixels and an empty shelf. Pages are
+    allocated on demand up to MAX_PAGES.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+class SpriteAtlas
+{
+public:
+    static constexpr int PAGE_SIZE = 1024;
+    // A sprite's depth buckets add up to about 20x the area of its largest one. 16 pages
+    // hold every bucket of the ~30 sprites a busy chart shows at a large editor size.
+    static constexpr int MAX_PAGES = 16;
+    static constexpr int PADDING = 1;   // Keeps filtering from bleeding between neighbours
+
+    // Whether the sprite fits on an empty page at all
+    static bool canHold(const juce::Image& sprite)
+    {
+        return sprite.isValid() && sprite.getWidth() + PADDING <= PAGE_SIZE && sprite.getHeight() + PADDING <= PAGE_SIZE;
+    }
+
+    // View of the sprite's slot and the index of its page, or an invalid image if it does
+    // not fit (caller keeps its own copy)
+    juce::Image add(const juce::Image& sprite, int& pageIndex)
+    {
+        if (!canHold(sprite))
+            return {};
+
+        const int width = sprite.getWidth() + PADDING;
+        const int height = sprite.getHeight() + PADDING;
+
+        juce::Point<int> slot;
+        pageIndex = allocate(width, height, slot);
+        if (pageIndex < 0)
+            return {};
+
+        Page* page = &pages[(size_t)pageIndex];
+
+        juce::Graphics g(page->image);
+        g.drawImageAt(sprite, slot.x, slot.y);
+
+        return page->image.getClippedImage({ slot.x, slot.y, sprite.getWidth(), sprite.getHeight() });
+    }
+
+    // Views handed out earlier keep their page alive until they are released
+    void clear() { pages.clear(); }
+
+    // Empties one page for reuse. Earlier views of it keep the old pixels, not the page.
+    void resetPage(int pageIndex)
+    {
+        if (pageIndex < 0 || pageIndex >= (int)pages.size())
+            return;
+
+        pages[(size_t)pageIndex] = createPage();
+    }
+
+    size_t getPageCount() const { return pages.size(); }
+
+private:
+    struct Page
+    {
+        juce::Image image;
+        int shelfX = 0;
+        int shelfY = 0;
+        int shelfHeight = 0;
+    };
+
+    static Page createPage()
+    {
+        // Software pages so the blitter can read them directly on every platform
+        return { juce::Image(juce::Image::ARGB, PAGE_SIZE, PAGE_SIZE, true, juce::SoftwareImageType()) };
+    }
+
+    // Index of the page the slot was placed on, or -1 when every page is full
+    int allocate(int width, int height, juce::Point<int>& slot)
+    {
+        // Any page may have room again after a reset, so try them all before adding one
+        for (size_t i = 0; i < pages.size(); i++)
+            if (place(pages[i], width, height, slot))
+                return (int)i;
+
+        if ((int)pages.size() >= MAX_PAGES)
+            return -1;
+
+        pages.push_back(createPage());
+        return place(pages.back(), width, height, slot) ? (int)pages.size() - 1 : -1;
+    }
+
+    static bool place(Page& page, int width, int height, juce::Point<int>& slot)
+    {
+        // Start a new shelf when this row is full (only once the sprite is known to fit,
+        // so a failed attempt leaves the current shelf open for smaller sprites)
+        int shelfX = page.shelfX, shelfY = page.shelfY, shelfHeight = page.shelfHeight;
+        if (shelfX + width > PAGE_SIZE)
+        {
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+        }
+
+        if (shelfY + height > PAGE_SIZE)
+            return false;
+
+        slot = { shelfX, shelfY };
+        page.shelfX = shelfX + width;
+        page.shelfY = shelfY;
+        page.shelfHeight = std::max(shelfHeight, height);
+        return true;
+    }
+
+    std::vector<Page> pages;
+};
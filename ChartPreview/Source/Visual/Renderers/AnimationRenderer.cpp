@@ -30,33 +30,40 @@ AnimationRenderer::~AnimationRenderer()
 //==============================================================================
 // Helper: Trigger animation for a specific gem column
 
-void AnimationRenderer::triggerAnimationForColumn(uint gemColumn)
+void AnimationRenderer::triggerAnimationForColumn(uint gemColumn, double sinceCrossing)
 {
     bool isDrums = !isPart(state, Part::GUITAR);
     bool is2xKick = isDrums && gemColumn == 6;
-    animationManager.triggerHit(gemColumn, isDrums, is2xKick);
+    animationManager.triggerHit(gemColumn, isDrums, is2xKick, sinceCrossing);
 }
 
 //==============================================================================
 // Animation Detection
 
-void AnimationRenderer::detectAndTriggerAnimations(const TimeBasedTrackWindow& trackWindow)
+void AnimationRenderer::detectAndTriggerAnimations(const TimeBasedTrackWindow& trackWindow, double cursorTime)
 {
     // Strikeline is at time 0 (current playback position)
-    // For each column, find the closest note that has passed the strikeline
-    // If it's a new note (different from last frame), trigger the animation
+    // A note crossed it since the last frame if its time from the cursor lies in
+    // (-advance, 0], where advance is how far the cursor moved. Consecutive frames
+    // tile these ranges, so each note is found exactly once.
+    double advance = cursorTime - lastCursorTime;
+    bool continuous = hasLastCursorTime && advance >= 0.0 && advance <= MAX_CROSSING_GAP_SECONDS;
+    lastCursorTime = cursorTime;
+    hasLastCursorTime = true;
+
+    // After a seek or a stall there is nothing to catch up on
+    if (!continuous)
+        return;
 
     std::array<double, 7> closestPastNotePerColumn = {999.0, 999.0, 999.0, 999.0, 999.0, 999.0, 999.0};
 
-    // Find the closest note that has just crossed (or is at) the strikeline for each column
+    // Find the latest note in each column that crossed the strikeline since the last frame
     for (const auto &frameItem : trackWindow)
     {
         double frameTime = frameItem.first;  // Time in seconds from cursor
         const auto& gems = frameItem.second;
 
-        // We only care about notes that have crossed or are at the strikeline (frameTime <= 0)
-        // And are close enough to be considered "just hit" (within a small past window)
-        if (frameTime <= 0.0 && frameTime >= -0.05)  // 50ms past window
+        if (frameTime <= 0.0 && frameTime > -advance)
         {
             for (uint gemColumn = 0; gemColumn < gems.size(); ++gemColumn)
             {
@@ -72,16 +79,12 @@ void AnimationRenderer::detectAndTriggerAnimations(const TimeBasedTrackWindow& t
         }
     }
 
-    // Now trigger animations for any column where we found a new note
+    // Trigger from the moment each note crossed, not from this frame
     for (uint gemColumn = 0; gemColumn < closestPastNotePerColumn.size(); ++gemColumn)
     {
-        // If we found a note (not 999.0) and it's different from the last one we processed
-        if (closestPastNotePerColumn[gemColumn] < 999.0 &&
-            closestPastNotePerColumn[gemColumn] != lastNoteTimePerColumn[gemColumn])
+        if (closestPastNotePerColumn[gemColumn] < 999.0)
         {
-            // This is a new note! Trigger the animation
-            lastNoteTimePerColumn[gemColumn] = closestPastNotePerColumn[gemColumn];
-            triggerAnimationForColumn(gemColumn);
+            triggerAnimationForColumn(gemColumn, -closestPastNotePerColumn[gemColumn]);
         }
     }
 }
@@ -123,7 +126,7 @@ void AnimationRenderer::updateSustainStates(const TimeBasedSustainWindow& sustai
 //==============================================================================
 // Animation Rendering
 
-void AnimationRenderer::renderToDrawCallMap(DrawCallMap& drawCallMap, uint width, uint height)
+void AnimationRenderer::renderToCommandBuffer(RenderCommandBuffer& commands, const PerspectiveLayout& layout)
 {
     const auto& animations = animationManager.getActiveAnimations();
     bool isGuitar = isPart(state, Part::GUITAR);
@@ -140,9 +143,7 @@ void AnimationRenderer::renderToDrawCallMap(DrawCallMap& drawCallMap, uint width
                 ? GUITAR_ANIMATION_OFFSETS[0]
                 : DRUM_ANIMATION_OFFSETS[0];
 
-            drawCallMap[DrawOrder::BAR_ANIMATION][column].push_back([this, anim, width, height, offset](juce::Graphics &g) {
-                this->renderKickAnimation(g, anim, width, height, offset);
-            });
+            renderKickAnimation(commands, anim, layout, offset);
         }
         else
         {
@@ -151,14 +152,12 @@ void AnimationRenderer::renderToDrawCallMap(DrawCallMap& drawCallMap, uint width
                 ? GUITAR_ANIMATION_OFFSETS[anim.lane]
                 : DRUM_ANIMATION_OFFSETS[anim.lane];
 
-            drawCallMap[DrawOrder::NOTE_ANIMATION][anim.lane].push_back([this, anim, width, height, offset](juce::Graphics &g) {
-                this->renderFretAnimation(g, anim, width, height, offset);
-            });
+            renderFretAnimation(commands, anim, layout, offset);
         }
     }
 }
 
-void AnimationRenderer::renderKickAnimation(juce::Graphics &g, const AnimationConstants::HitAnimation& anim, uint width, uint height, const PositionConstants::CoordinateOffset& offset)
+void AnimationRenderer::renderKickAnimation(RenderCommandBuffer& commands, const AnimationConstants::HitAnimation& anim, const PerspectiveLayout& layout, const PositionConstants::CoordinateOffset& offset)
 {
     // Strikeline is where notes are when frameTime = 0 (at the cursor position)
     float strikelinePosition = 0.0f;
@@ -175,12 +174,9 @@ void AnimationRenderer::renderKickAnimation(juce::Graphics &g, const AnimationCo
 
     if (animFrame)
     {
-        juce::Rectangle<float> kickRect;
-        if (isGuitar) {
-            kickRect = glyphRenderer.getGuitarGlyphRect(0, strikelinePosition, width, height);
-        } else {
-            kickRect = glyphRenderer.getDrumGlyphRect(anim.is2xKick ? 6 : 0, strikelinePosition, width, height);
-        }
+        // The layout is built for the current part, so column 0 is the open bar on guitar
+        uint barColumn = (!isGuitar && anim.is2xKick) ? 6 : 0;
+        juce::Rectangle<float> kickRect = layout.getGlyphRect(barColumn, strikelinePosition);
 
         // Apply animation-specific positioning and scaling
         kickRect = kickRect.withSizeKeepingCentre(
@@ -188,12 +184,11 @@ void AnimationRenderer::renderKickAnimation(juce::Graphics &g, const AnimationCo
             kickRect.getHeight() * offset.heightScale
         ).translated(offset.xOffset, offset.yOffset);
 
-        g.setOpacity(1.0f);
-        g.drawImage(*animFrame, kickRect);
+        commands.addSprite(DrawOrder::BAR_ANIMATION, anim.is2xKick ? 6 : 0, animFrame, kickRect, 1.0f);
     }
 }
 
-void AnimationRenderer::renderFretAnimation(juce::Graphics &g, const AnimationConstants::HitAnimation& anim, uint width, uint height, const PositionConstants::CoordinateOffset& offset)
+void AnimationRenderer::renderFretAnimation(RenderCommandBuffer& commands, const AnimationConstants::HitAnimation& anim, const PerspectiveLayout& layout, const PositionConstants::CoordinateOffset& offset)
 {
     // Strikeline is where notes are when frameTime = 0 (at the cursor position)
     float strikelinePosition = 0.0f;
@@ -204,12 +199,7 @@ void AnimationRenderer::renderFretAnimation(juce::Graphics &g, const AnimationCo
     auto hitFrame = assetManager.getHitAnimationFrame(anim.currentFrame);
     auto flareImage = assetManager.getHitFlareImage(anim.lane, currentPart);
 
-    juce::Rectangle<float> hitRect;
-    if (isGuitar) {
-        hitRect = glyphRenderer.getGuitarGlyphRect(anim.lane, strikelinePosition, width, height);
-    } else {
-        hitRect = glyphRenderer.getDrumGlyphRect(anim.lane, strikelinePosition, width, height);
-    }
+    juce::Rectangle<float> hitRect = layout.getGlyphRect(anim.lane, strikelinePosition);
 
     // Apply fret hit animation positioning and scaling
     hitRect = hitRect.withSizeKeepingCentre(
@@ -217,18 +207,20 @@ void AnimationRenderer::renderFretAnimation(juce::Graphics &g, const AnimationCo
         hitRect.getHeight() * offset.heightScale
     ).translated(offset.xOffset, offset.yOffset);
 
-    // Draw the flash frame
-    if (hitFrame)
+    // A column executes its latest command first, so submit the flare
+    // before the flash it is drawn on top of
+
+    // Draw the colored flare on top (with tint for the lane color), added like light
+    if (flareImage && anim.currentFrame <= HIT_FLARE_MAX_FRAME)
     {
-        g.setOpacity(HIT_FLASH_OPACITY);
-        g.drawImage(*hitFrame, hitRect);
+        commands.addSprite(DrawOrder::NOTE_ANIMATION, anim.lane, flareImage, hitRect, HIT_FLARE_OPACITY,
+                           SpriteBlitter::BlendMode::ADDITIVE);
     }
 
-    // Draw the colored flare on top (with tint for the lane color)
-    if (flareImage && anim.currentFrame <= HIT_FLARE_MAX_FRAME)
+    // Draw the flash frame
+    if (hitFrame)
     {
-        g.setOpacity(HIT_FLARE_OPACITY);
-        g.drawImage(*flareImage, hitRect);
+        commands.addSprite(DrawOrder::NOTE_ANIMATION, anim.lane, hitFrame, hitRect, HIT_FLASH_OPACITY);
     }
 }
 
@@ -237,14 +229,16 @@ void AnimationRenderer::renderFretAnimation(juce::Graphics &g, const AnimationCo
 
 void AnimationRenderer::advanceFrames()
 {
-    animationManager.advanceAllFrames();
+    double nowMs = juce::Time::getMillisecondCounterHiRes();
+    double elapsedSeconds = lastAdvanceMs > 0.0 ? (nowMs - lastAdvanceMs) / 1000.0 : 0.0;
+    lastAdvanceMs = nowMs;
+
+    animationManager.advanceAll(elapsedSeconds);
 }
 
 void AnimationRenderer::reset()
 {
     animationManager.reset();
-    // Reset tracking of note times
-    for (auto& noteTime : lastNoteTimePerColumn) {
-        noteTime = -999.0;
-    }
+    // The next detection starts a new run of crossings
+    hasLastCursorTime = false;
 }
@@ -19,9 +19,10 @@
 #include "../../Utils/Utils.h"
 #include "../../Utils/TimeConverter.h"
 #include "../Managers/AnimationManager.h"
-#include "GlyphRenderer.h"
+#include "RenderCommandBuffer.h"
 #include "../Managers/AssetManager.h"
 #include "../Utils/DrawingConstants.h"
+#include "../Utils/PerspectiveLayout.h"
 
 class AnimationRenderer
 {
@@ -29,11 +30,17 @@ public:
     AnimationRenderer(juce::ValueTree &state, MidiInterpreter &midiInterpreter);
     ~AnimationRenderer();
 
+    // Longest gap between frames whose strikeline crossings are still animated
+    // (anything longer is a seek or a stall); the track window needs to reach
+    // this far behind the cursor
+    static constexpr double MAX_CROSSING_GAP_SECONDS = 0.25;
+
     /**
-     * Detect notes that have crossed the strikeline and trigger animations.
+     * Detect notes that crossed the strikeline since the last frame and trigger animations.
+     * cursorTime is the cursor's absolute chart time in seconds.
      * Should be called once per frame when playback is active.
      */
-    void detectAndTriggerAnimations(const TimeBasedTrackWindow& trackWindow);
+    void detectAndTriggerAnimations(const TimeBasedTrackWindow& trackWindow, double cursorTime);
 
     /**
      * Update sustain states based on current sustain window.
@@ -43,15 +50,16 @@ public:
     void updateSustainStates(const TimeBasedSustainWindow& sustainWindow, bool isPlaying);
 
     /**
-     * Populate drawCallMap with animation render calls.
+     * Append animation sprites to the frame's command buffer.
      * Animations are added to BAR_ANIMATION and NOTE_ANIMATION layers for proper Z-ordering.
-     * Call before rendering the drawCallMap.
+     * layout must already be updated for this frame's part and size.
+     * Call before the command buffer is sorted and executed.
      */
-    void renderToDrawCallMap(DrawCallMap& drawCallMap, uint width, uint height);
+    void renderToCommandBuffer(RenderCommandBuffer& commands, const PerspectiveLayout& layout);
 
     /**
-     * Advance all active animations by one frame.
-     * Call this once per render frame after rendering.
+     * Advance all active animations by the wall-clock time since the last call.
+     * Call this once per render frame, before detecting new hits.
      */
     void advanceFrames();
 
@@ -64,14 +72,18 @@ private:
     juce::ValueTree &state;
     MidiInterpreter &midiInterpreter;
     AnimationManager animationManager;
-    GlyphRenderer glyphRenderer;
     AssetManager assetManager;
 
-    // Track the last note time per column to ensure every note triggers an animation
-    std::array<double, 7> lastNoteTimePerColumn = {-999.0, -999.0, -999.0, -999.0, -999.0, -999.0, -999.0};
+    // Cursor time of the last detection; crossings are searched between it and the
+    // current cursor, so every note triggers exactly once whatever the frame rate
+    double lastCursorTime = 0.0;
+    bool hasLastCursorTime = false;
+
+    // Wall-clock time of the last advance
+    double lastAdvanceMs = 0.0;
 
     // Helper: Trigger animation for a specific gem column
-    void triggerAnimationForColumn(uint gemColumn);
+    void triggerAnimationForColumn(uint gemColumn, double sinceCrossing = 0.0);
 
     // Helper: Determine if a gem column is a bar note (kick/open)
     bool isBarNote(uint gemColumn, Part part)
@@ -87,6 +99,6 @@ private:
     }
 
     // Rendering helpers
-    void renderKickAnimation(juce::Graphics &g, const AnimationConstants::HitAnimation& anim, uint width, uint height, const PositionConstants::CoordinateOffset& offset);
-    void renderFretAnimation(juce::Graphics &g, const AnimationConstants::HitAnimation& anim, uint width, uint height, const PositionConstants::CoordinateOffset& offset);
+    void renderKickAnimation(RenderCommandBuffer& commands, const AnimationConstants::HitAnimation& anim, const PerspectiveLayout& layout, const PositionConstants::CoordinateOffset& offset);
+    void renderFretAnimation(RenderCommandBuffer& commands, const AnimationConstants::HitAnimation& anim, const PerspectiveLayout& layout, const PositionConstants::CoordinateOffset& offset);
 };
@@ -0,0 +1,105 @@
+/*
+    ==============================================================================
+
+        BandRasterizer.cpp
+
+    ==============================================================================
+*/
+
+#include "BandRasterizer.h"
+
+BandRasterizer::BandRasterizer()
+{
+    bandEdges.reserve(MAX_BANDS + 1);
+}
+
+int BandRasterizer::getBandCount(int rowCount) const
+{
+    // Leave a core for the message and audio threads
+    int bands = juce::jmin(MAX_BANDS, juce::SystemStats::getNumCpus() - 1, rowCount / MIN_BAND_ROWS);
+    return juce::jmax(1, bands);
+}
+
+void BandRasterizer::beginFrame(int rowCount, int64_t baselineCost)
+{
+    rows = juce::jmax(0, rowCount);
+    costDeltas.assign((size_t)rows + 1, 0);
+    if (rows > 0)
+    {
+        costDeltas[0] += baselineCost;
+        costDeltas[(size_t)rows] -= baselineCost;
+    }
+}
+
+void BandRasterizer::addCost(int top, int bottom, int64_t costPerRow)
+{
+    top = juce::jlimit(0, rows, top);
+    bottom = juce::jlimit(0, rows, bottom);
+    if (top >= bottom) return;
+
+    costDeltas[(size_t)top] += costPerRow;
+    costDeltas[(size_t)bottom] -= costPerRow;
+}
+
+int BandRasterizer::plan()
+{
+    const int bandCount = getBandCount(rows);
+    if (bandCount == 1)
+    {
+        bandEdges.assign({ 0, rows });
+        return 1;
+    }
+
+    // Total cost, then cut wherever the running cost crosses the next equal share
+    int64_t total = 0, rowCost = 0;
+    for (int row = 0; row < rows; row++)
+    {
+        rowCost += costDeltas[(size_t)row];
+        total += rowCost;
+    }
+
+    bandEdges.assign((size_t)bandCount + 1, rows);
+    bandEdges[0] = 0;
+
+    int64_t running = 0;
+    rowCost = 0;
+    for (int row = 0, band = 1; row < rows && band < bandCount; row++)
+    {
+        rowCost += costDeltas[(size_t)row];
+        running += rowCost;
+        while (band < bandCount && running * bandCount >= total * band)
+            bandEdges[(size_t)band++] = row + 1;
+    }
+
+    return bandCount;
+}
+
+void BandRasterizer::run(const std::function<void(int band, int top, int bottom)>& rasterize)
+{
+    jassert(bandEdges.size() >= 2);  // plan() first
+    const int bandCount = (int)bandEdges.size() - 1;
+    if (bandCount == 1)
+    {
+        if (bandEdges[0] < bandEdges[1])
+            rasterize(0, bandEdges[0], bandEdges[1]);
+        return;
+    }
+
+    pendingBands = bandCount - 1;
+    for (int band = 1; band < bandCount; band++)
+    {
+        pool->addJob([this, &rasterize, band]
+        {
+            if (bandEdges[(size_t)band] < bandEdges[(size_t)band + 1])
+                rasterize(band, bandEdges[(size_t)band], bandEdges[(size_t)band + 1]);
+
+            if (--pendingBands == 0)
+                bandsDone.signal();
+        });
+    }
+
+    if (bandEdges[0] < bandEdges[1])
+        rasterize(0, bandEdges[0], bandEdges[1]);
+
+    bandsDone.wait();
+}
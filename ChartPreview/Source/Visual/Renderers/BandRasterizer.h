@@ -0,0 +1,75 @@
+/*
+    ==============================================================================
+
+        BandRasterizer.h
+
+        Splits a frame into horizontal bands and rasterizes them concurrently.
+        Callers first describe where the work lies (a cost per pixel row, e.g.
+        the widths of the sprites crossing it); plan() then cuts the rows into
+        bands of roughly equal cost, so the few large near-strikeline rows and
+        the many small far rows spread evenly, and run() hands each band to a
+        worker. The calling thread rasterizes the first band itself.
+
+        Workers come from one thread pool shared by every editor in the
+        process. Bands never overlap, so band callbacks may write the raw
+        pixels of the same image as long as each stays inside its rows. Going
+        through JUCE is different: creating a BitmapData for writing, which
+        every Graphics fill does, is not thread-safe on a shared image. Pool
+        bands should draw through a Graphics only onto images of their own,
+        with any shared BitmapData set up on the calling thread between
+        plan() and run().
+
+    ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class BandRasterizer
+{
+public:
+    static constexpr int MAX_BANDS = 8;
+    static constexpr int MIN_BAND_ROWS = 32;    // Below this, splitting costs more than it saves
+
+    BandRasterizer();
+
+    // Bands a frame of this many rows will be split into (1 = no parallelism)
+    int getBandCount(int rows) const;
+
+    // Start describing a frame; every row costs at least baselineCost
+    void beginFrame(int rows, int64_t baselineCost);
+    // Work covering rows [top, bottom), costing costPerRow on each
+    void addCost(int top, int bottom, int64_t costPerRow);
+
+    // Cuts the described frame into bands and returns how many
+    int plan();
+    // Rows [start, end) of a planned band (may be empty)
+    juce::Range<int> getBand(int band) const { return { bandEdges[(size_t)band], bandEdges[(size_t)band + 1] }; }
+
+    // Calls rasterize(band, top, bottom) for every non-empty planned band and
+    // returns once all of them are done
+    void run(const std::function<void(int band, int top, int bottom)>& rasterize);
+
+private:
+    struct Pool : public juce::ThreadPool
+    {
+        Pool() : juce::ThreadPool(juce::jmax(1, getWorkerCount())) {}
+        static int getWorkerCount() { return juce::jmin(MAX_BANDS, juce::SystemStats::getNumCpus() - 1) - 1; }
+    };
+
+    juce::SharedResourcePointer<Pool> pool;
+
+    int rows = 0;
+    std::vector<int64_t> costDeltas;    // Difference array: cost of row r is the prefix sum up to r
+    std::vector<int> bandEdges;
+
+    std::atomic<int> pendingBands { 0 };
+    juce::WaitableEvent bandsDone;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BandRasterizer)
+};
@@ -5,7 +5,7 @@
         Created by Claude Code (refactoring column/sustain rendering logic)
         Author: Noah Baxter
 
-        This file contains all column and sustain path generation logic.
+        This file contains all column and sustain geometry logic.
         Handles rendering of vertical elements like sustains, BREs, sections, etc.
 
     ==============================================================================
@@ -14,68 +14,85 @@
 #include "ColumnRenderer.h"
 
 //==============================================================================
-// Trapezoid Path Generation
-
-juce::Path ColumnRenderer::createTrapezoidPath(LaneCorners start, LaneCorners end, float startWidth, float endWidth)
-{
-    juce::Path path;
-    float startCenterX = (start.leftX + start.rightX) / 2.0f;
-    float endCenterX = (end.leftX + end.rightX) / 2.0f;
-
-    path.startNewSubPath(startCenterX - startWidth / 2.0f, start.centerY);
-    path.lineTo(startCenterX + startWidth / 2.0f, start.centerY);
-    path.lineTo(endCenterX + endWidth / 2.0f, end.centerY);
-    path.lineTo(endCenterX - endWidth / 2.0f, end.centerY);
-    path.closeSubPath();
-
-    return path;
-}
-
-//==============================================================================
-// Rounded Cap Path Generation
-
-juce::Path ColumnRenderer::createRoundedCapPath(LaneCorners coords, float width, float radius, float heightScale)
+// Column Fill
+
+void ColumnRenderer::fillColumn(juce::Graphics& g,
+                                LaneCorners start, LaneCorners end,
+                                float startWidth, float endWidth,
+                                float radius, float endCapHeightScale,
+                                juce::Colour colour,
+                                float rowHeight)
 {
-    juce::Path path;
-    float centerX = (coords.leftX + coords.rightX) / 2.0f;
-    float capHeight = radius * 2.0f * heightScale;
-
-    path.addRoundedRectangle(
-        centerX - width / 2.0f,
-        coords.centerY - capHeight / 2.0f,
-        width,
-        capHeight,
-        radius * heightScale
-    );
-
-    return path;
+    const float startCenterX = (start.leftX + start.rightX) / 2.0f;
+    const float endCenterX = (end.leftX + end.rightX) / 2.0f;
+
+    // Scale end cap height proportionally to width for natural perspective
+    const Cap startCap { startCenterX, start.centerY, startWidth, radius * 2.0f, radius };
+    const Cap endCap { endCenterX, end.centerY, endWidth, radius * 2.0f * endCapHeightScale, radius * endCapHeightScale };
+
+    // Trapezoid body; the caps only show above and below it
+    const float bodyTop = std::min(start.centerY, end.centerY);
+    const float bodyBottom = std::max(start.centerY, end.centerY);
+    const float bodySpan = end.centerY - start.centerY;
+
+    float top = std::min({ bodyTop, startCap.centerY - startCap.height / 2.0f, endCap.centerY - endCap.height / 2.0f });
+    float bottom = std::max({ bodyBottom, startCap.centerY + startCap.height / 2.0f, endCap.centerY + endCap.height / 2.0f });
+
+    // Skip rows outside the clip (e.g. another band's). The clip is whole pixels, so the
+    // remaining rows keep the same boundaries they would have unclipped.
+    const auto clip = g.getClipBounds().toFloat();
+    top = std::max(top, clip.getY());
+    bottom = std::min(bottom, clip.getBottom());
+
+    spans.clear();
+
+    // One span per row (on a fixed grid, so clipping never moves a row), also split where the body starts and ends
+    float y = top;
+    while (y < bottom)
+    {
+        float next = std::min((std::floor(y / rowHeight) + 1.0f) * rowHeight, bottom);
+        if (y < bodyTop && next > bodyTop) next = bodyTop;
+        else if (y < bodyBottom && next > bodyBottom) next = bodyBottom;
+
+        const float rowY = (y + next) / 2.0f;
+        float left = std::numeric_limits<float>::max();
+        float right = std::numeric_limits<float>::lowest();
+
+        if (rowY >= bodyTop && rowY <= bodyBottom)
+        {
+            float t = bodySpan != 0.0f ? (rowY - start.centerY) / bodySpan : 0.0f;
+            float centerX = startCenterX + (endCenterX - startCenterX) * t;
+            float halfWidth = (startWidth + (endWidth - startWidth) * t) / 2.0f;
+            left = centerX - halfWidth;
+            right = centerX + halfWidth;
+        }
+        else
+        {
+            startCap.addSpan(rowY, left, right);
+            endCap.addSpan(rowY, left, right);
+        }
+
+        if (right > left)
+            spans.addWithoutMerging({ left, y, right - left, next - y });
+
+        y = next;
+    }
+
+    g.setColour(colour);
+    g.fillRectList(spans);
 }
 
-//==============================================================================
-// Offscreen Sustain Image Rendering
-
-juce::Image ColumnRenderer::createOffscreenColumnImage(
-    const juce::Path& trapezoid,
-    const juce::Path& startCap,
-    const juce::Path& endCap,
-    juce::Colour colour)
+void ColumnRenderer::Cap::addSpan(float y, float& left, float& right) const
 {
-    auto bounds = trapezoid.getBounds().getUnion(startCap.getBounds()).getUnion(endCap.getBounds());
-    int width = (int)std::ceil(bounds.getWidth()) + 2;
-    int height = (int)std::ceil(bounds.getHeight()) + 2;
-
-    juce::Image image(juce::Image::ARGB, width, height, true);
-    juce::Graphics graphics(image);
-
-    // Translate to local coordinates
-    graphics.addTransform(juce::AffineTransform::translation(-bounds.getX() + 1, -bounds.getY() + 1));
-    graphics.setColour(colour);
+    const float halfHeight = height / 2.0f;
+    const float dy = std::abs(y - centerY);
+    if (dy > halfHeight) return;
 
-    // Draw trapezoid, then caps with clipping to avoid overlap
-    graphics.fillPath(trapezoid);
-    graphics.excludeClipRegion(trapezoid.getBounds().toNearestInt());
-    graphics.fillPath(startCap);
-    graphics.fillPath(endCap);
+    // Corners are circular and clamped to the rectangle, as in Path::addRoundedRectangle
+    const float corner = std::min({ cornerSize, width / 2.0f, halfHeight });
+    const float cornerDepth = dy - (halfHeight - corner);
+    const float inset = cornerDepth > 0.0f ? corner - std::sqrt(std::max(0.0f, corner * corner - cornerDepth * cornerDepth)) : 0.0f;
 
-    return image;
+    left = std::min(left, centerX - width / 2.0f + inset);
+    right = std::max(right, centerX + width / 2.0f - inset);
 }
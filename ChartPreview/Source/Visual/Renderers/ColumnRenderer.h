@@ -5,7 +5,7 @@
         Created by Claude Code (refactoring column/sustain rendering logic)
         Author: Noah Baxter
 
-        This file contains all column and sustain path generation logic.
+        This file contains all column and sustain geometry logic.
         Handles rendering of vertical elements like sustains, BREs, sections, etc.
         Uses PositionConstants for lane coordinate calculations.
 
@@ -31,16 +31,28 @@ public:
     ~ColumnRenderer() = default;
 
     //==============================================================================
-    // Trapezoid and cap path generation for column rendering
-    juce::Path createTrapezoidPath(LaneCorners start, LaneCorners end, float startWidth, float endWidth);
-    juce::Path createRoundedCapPath(LaneCorners coords, float width, float radius, float heightScale = 1.0f);
-
-    //==============================================================================
-    // Offscreen rendering for column compositing
-    juce::Image createOffscreenColumnImage(
-        const juce::Path& trapezoid,
-        const juce::Path& startCap,
-        const juce::Path& endCap,
-        juce::Colour colour
-    );
+    // Column fill: a trapezoid between two lane positions with rounded caps at both ends.
+    // The outline is split into non-overlapping horizontal spans (one per pixel row)
+    // and filled in a single call, so the column composites at one opacity without
+    // an offscreen image or path rasterization. A larger rowHeight trades edge
+    // smoothness for fewer spans.
+    void fillColumn(juce::Graphics& g,
+                    LaneCorners start, LaneCorners end,
+                    float startWidth, float endWidth,
+                    float radius, float endCapHeightScale,
+                    juce::Colour colour,
+                    float rowHeight = 1.0f);
+
+private:
+    // Rounded rectangle centred on a lane position, as built by Path::addRoundedRectangle
+    struct Cap
+    {
+        float centerX, centerY, width, height, cornerSize;
+
+        // Widen [left, right] by this cap's extent at row y
+        void addSpan(float y, float& left, float& right) const;
+    };
+
+    // Reused between calls so steady-state frames don't allocate
+    juce::RectangleList<float> spans;
 };
@@ -5,8 +5,8 @@
         Created by Claude Code (refactoring positioning logic)
         Author: Noah Baxter
 
-        This file contains glyph (note) positioning and rendering logic.
-        Uses PositionConstants for all positioning data.
+        This file contains glyph (note) overlay positioning.
+        Base glyph rects come from PerspectiveLayout.
 
     ==============================================================================
 */
@@ -27,30 +27,7 @@ public:
     GlyphRenderer() = default;
     ~GlyphRenderer() = default;
 
-    //==============================================================================
-    // Guitar Glyph Positioning
-    juce::Rectangle<float> getGuitarGlyphRect(uint gemColumn, float position, uint width, uint height);
-    juce::Rectangle<float> getGuitarGridlineRect(float position, uint width, uint height);
-
-    //==============================================================================
-    // Drum Glyph Positioning
-    juce::Rectangle<float> getDrumGlyphRect(uint gemColumn, float position, uint width, uint height);
-    juce::Rectangle<float> getDrumGridlineRect(float position, uint width, uint height);
-
     //==============================================================================
     // Overlay Positioning
     juce::Rectangle<float> getOverlayGlyphRect(juce::Rectangle<float> glyphRect, bool isDrumAccent);
-
-private:
-
-    //==============================================================================
-    // Core perspective calculation
-    juce::Rectangle<float> createPerspectiveGlyphRect(
-        float position,
-        float normY1, float normY2,
-        float normX1, float normX2,
-        float normWidth1, float normWidth2,
-        bool isBarNote,
-        uint width, uint height
-    );
 };
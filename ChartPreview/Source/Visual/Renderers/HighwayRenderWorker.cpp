@@ -0,0 +1,92 @@
+/*
+    ==============================================================================
+
+        HighwayRenderWorker.cpp
+
+    ==============================================================================
+*/
+
+#include "HighwayRenderWorker.h"
+
+HighwayRenderWorker::HighwayRenderWorker(RenderCallback renderCallback)
+    : juce::Thread("Chart Preview Render"),
+      render(std::move(renderCallback))
+{
+}
+
+HighwayRenderWorker::~HighwayRenderWorker()
+{
+    stop();
+}
+
+void HighwayRenderWorker::start()
+{
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::high);
+}
+
+void HighwayRenderWorker::stop()
+{
+    // Never kill the thread mid-frame: it would leave the render pipeline half updated
+    stopThread(-1);
+
+    const juce::ScopedLock lock(requestLock);
+    pendingRequest = {};
+    hasPendingRequest = false;
+}
+
+void HighwayRenderWorker::submit(FrameRequest request)
+{
+    {
+        const juce::ScopedLock lock(requestLock);
+
+        // Replacing a request the worker never picked up must not lose its settings
+        if (hasPendingRequest && !request.settings.isValid())
+            request.settings = pendingRequest.settings;
+
+        pendingRequest = std::move(request);
+        hasPendingRequest = true;
+    }
+
+    notify();
+}
+
+void HighwayRenderWorker::drawLatestFrame(juce::Graphics& g)
+{
+    const juce::ScopedLock lock(frameLock);
+    if (frontBuffer.isValid())
+        g.drawImageTransformed(frontBuffer, juce::AffineTransform::scale(1.0f / frontPixelScale));
+}
+
+void HighwayRenderWorker::run()
+{
+    while (!threadShouldExit())
+    {
+        FrameRequest request;
+        bool hasRequest = false;
+        {
+            const juce::ScopedLock lock(requestLock);
+            if (hasPendingRequest)
+            {
+                request = std::move(pendingRequest);
+                pendingRequest = {};
+                hasPendingRequest = false;
+                hasRequest = true;
+            }
+        }
+
+        if (!hasRequest)
+        {
+            wait(-1);   // Woken by submit() or stopThread()
+            continue;
+        }
+
+        float frameScale = request.pixelScale;
+        juce::Image& rendered = render(request, frameScale);
+
+        const juce::ScopedLock lock(frameLock);
+        std::swap(rendered, frontBuffer);
+        frontPixelScale = frameScale;
+        completedFrames++;
+    }
+}
@@ -0,0 +1,78 @@
+/*
+    ==============================================================================
+
+        HighwayRenderWorker.h
+
+        Optional background thread that renders the highway off the message
+        thread. Each paint submits a FrameRequest (the newest one replaces any
+        the worker has not started yet); the worker renders it through the
+        editor's callback and swaps the finished image into the front buffer
+        under a short lock. paint() then only draws the front buffer, so a
+        slow frame can no longer stall the host UI.
+
+        While the worker runs it owns the whole render pipeline (interpreter,
+        timeline, renderer, frame arena). The editor must stop it before
+        touching any of them on the message thread again.
+
+    ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include "../../Utils/Utils.h"
+
+class HighwayRenderWorker : private juce::Thread
+{
+public:
+    // Everything one frame needs from the message thread
+    struct FrameRequest
+    {
+        PPQ cursorPPQ = 0.0;
+        PPQ latencyBufferEnd = 0.0;
+        double windowTimeSeconds = 1.0;
+        double fallbackBPM = 120.0;     // Tempo to assume without a host tempo map
+        bool isPlaying = false;
+        int width = 0, height = 0;
+        float pixelScale = 1.0f;
+        juce::ValueTree settings;       // Copy of the plugin state if it changed, otherwise invalid
+    };
+
+    // Renders a request and returns the image it drew into, setting frameScale to the image's
+    // physical pixels per logical pixel. The worker swaps that image with the previous front
+    // buffer, which the callback then gets to draw the next frame into.
+    using RenderCallback = std::function<juce::Image&(const FrameRequest&, float& frameScale)>;
+
+    explicit HighwayRenderWorker(RenderCallback renderCallback);
+    ~HighwayRenderWorker() override;
+
+    void start();
+    void stop();    // Blocks until the frame in progress is finished
+    bool isRunning() const { return isThreadRunning(); }
+
+    // Message thread
+    void submit(FrameRequest request);
+    void drawLatestFrame(juce::Graphics& g);
+
+    // Frames finished so far; a change means the front buffer holds something not yet drawn
+    uint64_t getCompletedFrameCount() const { return completedFrames.load(); }
+
+private:
+    void run() override;
+
+    RenderCallback render;
+
+    juce::CriticalSection requestLock;
+    FrameRequest pendingRequest;
+    bool hasPendingRequest = false;
+
+    // Held only while swapping or drawing the front buffer
+    juce::CriticalSection frameLock;
+    juce::Image frontBuffer;
+    float frontPixelScale = 1.0f;
+    std::atomic<uint64_t> completedFrames { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (HighwayRenderWorker)
+};
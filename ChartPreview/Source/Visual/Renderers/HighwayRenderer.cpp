@@ -26,12 +26,51 @@ HighwayRenderer::~HighwayRenderer()
 {
 }
 
-void HighwayRenderer::paint(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, bool isPlaying)
+void HighwayRenderer::paint(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, double cursorTime, bool isPlaying)
 {
     // Set the drawing area dimensions from the graphics context
     auto clipBounds = g.getClipBounds();
-    width = clipBounds.getWidth();
-    height = clipBounds.getHeight();
+    float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    render(clipBounds.getWidth(), clipBounds.getHeight(), scale, trackWindow, sustainWindow, gridlines, windowStartTime, windowEndTime, cursorTime, isPlaying);
+    g.drawImageTransformed(frameBuffer, juce::AffineTransform::scale(1.0f / pixelScale));
+}
+
+float HighwayRenderer::getRenderScale(float displayScale) const
+{
+    switch ((int)state["renderScale"])
+    {
+    case 2: return 0.75f;
+    case 3: return 0.5f;
+    case 4:
+    {
+        // Auto: cap the physical pixel count, so large editors rasterize a smaller image
+        double physicalPixels = (double)width * height * displayScale * displayScale;
+        if (physicalPixels <= AUTO_RENDER_SCALE_PIXELS) return 1.0f;
+        return juce::jmax(MIN_RENDER_SCALE, (float)std::sqrt(AUTO_RENDER_SCALE_PIXELS / physicalPixels));
+    }
+    default: return 1.0f;
+    }
+}
+
+juce::Image& HighwayRenderer::render(uint areaWidth, uint areaHeight, float scale, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, double cursorTime, bool isPlaying)
+{
+    double frameStartMs = juce::Time::getMillisecondCounterHiRes();
+
+    width = areaWidth;
+    height = areaHeight;
+
+    // Sprites are pre-scaled for this size and the internal resolution. The governor's
+    // reduced resolution doesn't retarget the cache: variants are keyed by pixel size, so
+    // the reduced set is cached alongside the full one and stepping back and forth between
+    // them doesn't resample everything each time. LRU eviction ages out whichever goes unused.
+    float targetScale = scale * getRenderScale(scale);
+    assetManager.setSpriteTarget(width, height, targetScale);
+    pixelScale = targetScale;
+    if (governor.isAtLeast(FrameBudgetGovernor::Quality::REDUCED_RESOLUTION))
+        pixelScale *= REDUCED_RESOLUTION_SCALE;
+    assetManager.beginSpriteFrame();
+    perspectiveLayout.update(isPart(state, Part::GUITAR) ? Part::GUITAR : Part::DRUMS, width, height);
 
     // Calculate the total time window
     double windowTimeSpan = windowEndTime - windowStartTime;
@@ -45,41 +84,197 @@ void HighwayRenderer::paint(juce::Graphics &g, const TimeBasedTrackWindow& track
         animationRenderer.reset();
     }
 
-    // Repopulate drawCallMap
-    drawCallMap.clear();
-    drawNotesFromMap(g, trackWindow, windowStartTime, windowEndTime);
-    drawSustainFromWindow(g, sustainWindow, windowStartTime, windowEndTime);
-    drawGridlinesFromMap(g, gridlines, windowStartTime, windowEndTime);
+    // Repopulate the command buffer
+    renderCommands.clear();
+    drawNotesFromMap(trackWindow, windowStartTime, windowEndTime);
+    drawSustainFromWindow(sustainWindow, windowStartTime, windowEndTime);
+    drawGridlinesFromMap(gridlines, windowStartTime, windowEndTime);
 
-    // Detect and add animations to drawCallMap (if enabled)
+    // Bring animations up to now, detect new hits and add animations to the command buffer (if enabled)
     bool hitIndicatorsEnabled = state.getProperty("hitIndicators");
     if (hitIndicatorsEnabled)
     {
-        if (isPlaying) { animationRenderer.detectAndTriggerAnimations(trackWindow); }
-        animationRenderer.renderToDrawCallMap(drawCallMap, width, height);
+        animationRenderer.advanceFrames();
+        if (isPlaying) { animationRenderer.detectAndTriggerAnimations(trackWindow, cursorTime); }
+        animationRenderer.renderToCommandBuffer(renderCommands, perspectiveLayout);
     }
 
-    // Draw layer by layer, then column by column within each layer
-    for (const auto& drawOrder : drawCallMap)
+    // Compose into the frame buffer, layer by layer, then column by column within each layer, back to front
+    prepareFrameBuffer();
+    const auto& commands = renderCommands.sort();
+    resolveSprites(commands);
+
+    const int bufferHeight = frameBuffer.getHeight();
+    bool parallelRender = state.getProperty("parallelRender");
+    if (!parallelRender || bandRasterizer.getBandCount(bufferHeight) == 1)
+    {
+        BandTarget target(frameBuffer, 0, pixelScale, 0, bufferHeight);
+        rasterizeBand(commands, columnRenderers[0], target);
+    }
+    else
     {
-        for (const auto& column : drawOrder.second)
+        // Balance the bands on sprite area; lanes and sustains cover roughly a quarter of every row
+        bandRasterizer.beginFrame(bufferHeight, frameBuffer.getWidth() / 4);
+        for (const auto& sprite : resolvedSprites)
+            bandRasterizer.addCost(sprite.pixelRect.getY(), sprite.pixelRect.getBottom(), sprite.pixelRect.getWidth());
+
+        // Only this thread touches the frame buffer through JUCE: every Graphics fill opens
+        // a writable BitmapData on its image, which isn't safe on one image from several
+        // threads. The first band runs here and draws on the frame buffer directly. The
+        // others draw into their own strip and copy its rows into place through frameData.
+        const int bandCount = bandRasterizer.plan();
+        juce::Image::BitmapData frameData(frameBuffer, juce::Image::BitmapData::readWrite);
+        for (int band = 0; band < bandCount; band++)
         {
-            // Draw each layer from back to front
-            for (auto it = column.second.rbegin(); it != column.second.rend(); ++it)
-            {
-                (*it)(g);
-            }
+            auto rows = bandRasterizer.getBand(band);
+            if (rows.isEmpty())
+                continue;
+
+            if (band == 0)
+                bandTargets[0].emplace(frameBuffer, 0, pixelScale, rows.getStart(), rows.getEnd());
+            else
+                bandTargets[(size_t)band].emplace(getBandStrip(band, rows.getLength()), rows.getStart(),
+                                                  pixelScale, rows.getStart(), rows.getEnd());
         }
+
+        bandRasterizer.run([this, &commands, &frameData](int band, int top, int bottom)
+        {
+            auto& target = *bandTargets[(size_t)band];
+            const size_t rowBytes = (size_t)(target.data.width * target.data.pixelStride);
+
+            // Strips are reused between frames
+            if (band > 0)
+                for (int row = 0; row < bottom - top; row++)
+                    std::memset(target.data.getLinePointer(row), 0, rowBytes);
+
+            rasterizeBand(commands, columnRenderers[(size_t)band], target);
+
+            if (band > 0)
+                for (int row = 0; row < bottom - top; row++)
+                    std::memcpy(frameData.getLinePointer(top + row), target.data.getLinePointer(row), rowBytes);
+        });
+
+        for (auto& target : bandTargets)
+            target.reset();
     }
 
-    // Advance animation frames after rendering
-    if (hitIndicatorsEnabled)
+    governor.addFrame(juce::Time::getMillisecondCounterHiRes() - frameStartMs);
+    return frameBuffer;
+}
+
+void HighwayRenderer::prepareFrameBuffer()
+{
+    const int bufferWidth = juce::jmax(1, juce::roundToInt((float)width * pixelScale));
+    const int bufferHeight = juce::jmax(1, juce::roundToInt((float)height * pixelScale));
+
+    if (frameBuffer.getWidth() != bufferWidth || frameBuffer.getHeight() != bufferHeight)
+        frameBuffer = juce::Image(juce::Image::ARGB, bufferWidth, bufferHeight, true, juce::SoftwareImageType());
+    else
+        frameBuffer.clear(frameBuffer.getBounds());
+}
+
+void HighwayRenderer::resolveSprites(const std::vector<RenderCommand>& commands)
+{
+    resolvedSprites.resize(commands.size());
+    for (size_t i = 0; i < commands.size(); i++)
     {
-        animationRenderer.advanceFrames();
+        const auto& command = commands[i];
+        if (command.type == RenderCommand::Type::FILL)
+        {
+            resolvedSprites[i] = { {}, (command.getFillRect() * pixelScale).toNearestInt() };
+            continue;
+        }
+        if (command.type != RenderCommand::Type::SPRITE)
+        {
+            resolvedSprites[i] = { {}, {} };
+            continue;
+        }
+
+        // Snapped to physical pixels, then to the variant's bucket size, so it blits 1:1
+        auto pixelRect = (command.getSpriteRect() * pixelScale).toNearestInt();
+        juce::Image* variant = assetManager.getScaledSprite(command.sprite.image, pixelRect.getWidth(), pixelRect.getHeight());
+        if (variant == nullptr)
+        {
+            resolvedSprites[i] = { {}, pixelRect };
+            continue;
+        }
+
+        resolvedSprites[i] = { *variant, pixelRect.withSizeKeepingCentre(variant->getWidth(), variant->getHeight()) };
+    }
+}
+
+juce::Image& HighwayRenderer::getBandStrip(int band, int rows)
+{
+    // Only grows, so steady-state frames don't allocate as the band edges move
+    auto& strip = bandStrips[(size_t)band];
+    if (!strip.isValid() || strip.getWidth() != frameBuffer.getWidth() || strip.getHeight() < rows)
+        strip = juce::Image(juce::Image::ARGB, frameBuffer.getWidth(), rows, false, juce::SoftwareImageType());
+    return strip;
+}
+
+HighwayRenderer::BandTarget::BandTarget(juce::Image& image, int imageTop, float scale, int top, int bottom)
+    : graphics(image),
+      data(image, 0, top - imageTop, image.getWidth(), bottom - top, juce::Image::BitmapData::readWrite),
+      top(top),
+      bottom(bottom)
+{
+    // Physical frame rows map onto the image's rows, so a strip gets the same pixel grid
+    graphics.setOrigin(0, -imageTop);
+    graphics.reduceClipRegion(0, top, image.getWidth(), bottom - top);
+    graphics.addTransform(juce::AffineTransform::scale(scale));
+}
+
+void HighwayRenderer::rasterizeBand(const std::vector<RenderCommand>& commands, ColumnRenderer& columns, BandTarget& target)
+{
+    // Sprites are blitted straight into the band's pixels; sustains and fallback sprites go
+    // through a Graphics in logical coordinates, clipped to the band. Both write the same
+    // software bitmap, so they interleave in command order.
+    juce::Graphics& bandGraphics = target.graphics;
+    juce::Image::BitmapData& bandData = target.data;
+    const int top = target.top, bottom = target.bottom;
+
+    // Runs of fallback sprites at the same opacity only set it once
+    float currentOpacity = -1.0f;
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        const auto& command = commands[i];
+        switch (command.type)
+        {
+            case RenderCommand::Type::SPRITE:
+            {
+                const auto& sprite = resolvedSprites[i];
+                if (sprite.pixelRect.getBottom() <= top || sprite.pixelRect.getY() >= bottom)
+                    break;
+
+                if (!sprite.image.isValid() && command.opacity != currentOpacity)
+                {
+                    bandGraphics.setOpacity(command.opacity);
+                    currentOpacity = command.opacity;
+                }
+                draw(bandGraphics, bandData, top, command, sprite);
+                break;
+            }
+            case RenderCommand::Type::FILL:
+            {
+                const auto& rect = resolvedSprites[i].pixelRect;
+                if (rect.getBottom() <= top || rect.getY() >= bottom)
+                    break;
+
+                bandGraphics.setColour(juce::Colour(command.fill.argb).withMultipliedAlpha(command.opacity));
+                bandGraphics.fillRect(command.getFillRect());
+                currentOpacity = -1.0f;  // Replaced the fill colour
+                break;
+            }
+            case RenderCommand::Type::SUSTAIN:
+                drawPerspectiveSustainFlat(bandGraphics, columns, command.column, command.sustain.startPosition, command.sustain.endPosition,
+                                           command.opacity, command.sustain.widthScale, juce::Colour(command.sustain.argb));
+                currentOpacity = -1.0f;  // Sustains replace the fill colour
+                break;
+        }
     }
 }
 
-void HighwayRenderer::drawNotesFromMap(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, double windowStartTime, double windowEndTime)
+void HighwayRenderer::drawNotesFromMap(const TimeBasedTrackWindow& trackWindow, double windowStartTime, double windowEndTime)
 {
     double windowTimeSpan = windowEndTime - windowStartTime;
 
@@ -97,31 +292,59 @@ void HighwayRenderer::drawNotesFromMap(juce::Graphics &g, const TimeBasedTrackWi
     }
 }
 
-void HighwayRenderer::drawGridlinesFromMap(juce::Graphics &g, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime)
+void HighwayRenderer::drawGridlinesFromMap(const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime)
 {
     double windowTimeSpan = windowEndTime - windowStartTime;
 
-    for (const auto &gridline : gridlines)
+    // Screen Y of the previous gridline of any type and of the previous beat or measure.
+    // Spacing only shrinks towards the far end, so half-beats thin out first, then beats;
+    // measures are always drawn.
+    float previousY = std::numeric_limits<float>::max();
+    float previousBeatY = std::numeric_limits<float>::max();
+    const float minGap = LOD_GRIDLINE_MIN_GAP / pixelScale;
+
+    // Lay out every gridline in one pass, then filter
+    gridlinePositions.resize(gridlines.size());
+    for (size_t i = 0; i < gridlines.size(); i++)
+        gridlinePositions[i] = (float)((gridlines[i].time - windowStartTime) / windowTimeSpan);
+    perspectiveLayout.layout(PerspectiveLayout::Target::GRIDLINE, 0, gridlinePositions.data(), gridlinePositions.size(), gridlineRects);
+
+    for (size_t i = 0; i < gridlines.size(); i++)
     {
-        double gridlineTime = gridline.time;  // Time in seconds from cursor
-        Gridline gridlineType = gridline.type;
+        Gridline gridlineType = gridlines[i].type;
+        float normalizedPosition = gridlinePositions[i];
 
-        // Normalize position: 0 = far (window start), 1 = near (window end/strikeline)
-        float normalizedPosition = (float)((gridlineTime - windowStartTime) / windowTimeSpan);
+        // Half-beat lines are the first detail to go when over budget
+        if (gridlineType == Gridline::HALF_BEAT && governor.isAtLeast(FrameBudgetGovernor::Quality::SPARSE_GRIDLINES))
+            continue;
 
         if (normalizedPosition >= 0.0f && normalizedPosition <= 1.0f)
         {
+            juce::Rectangle<float> rect = gridlineRects[i];
+            float y = rect.getCentreY();
+
+            bool tooClose = false;
+            switch (gridlineType) {
+                case Gridline::MEASURE: break;
+                case Gridline::BEAT: tooClose = previousBeatY - y < minGap; break;
+                case Gridline::HALF_BEAT: tooClose = previousY - y < minGap; break;
+            }
+
+            previousY = y;
+            if (gridlineType != Gridline::HALF_BEAT)
+                previousBeatY = y;
+
             juce::Image *markerImage = assetManager.getGridlineImage(gridlineType);
 
-            if (markerImage != nullptr)
+            if (markerImage != nullptr && !tooClose)
             {
-                drawCallMap[DrawOrder::GRID][0].push_back([=](juce::Graphics &g) { drawGridline(g, normalizedPosition, markerImage, gridlineType); });
+                drawGridline(rect, markerImage, gridlineType);
             }
         }
     }
 }
 
-void HighwayRenderer::drawGridline(juce::Graphics& g, float position, juce::Image* markerImage, Gridline gridlineType)
+void HighwayRenderer::drawGridline(juce::Rectangle<float> rect, juce::Image* markerImage, Gridline gridlineType)
 {
     if (!markerImage) return;
     
@@ -132,16 +355,9 @@ void HighwayRenderer::drawGridline(juce::Graphics& g, float position, juce::Imag
         case Gridline::HALF_BEAT: opacity = HALF_BEAT_OPACITY; break;
     }
 
-    if (isPart(state, Part::GUITAR))
-    {
-        juce::Rectangle<float> rect = glyphRenderer.getGuitarGridlineRect(position, width, height);
-        draw(g, markerImage, rect, opacity);
-    }
-    else // if (isPart(state, Part::DRUMS))
-    {
-        juce::Rectangle<float> rect = glyphRenderer.getDrumGridlineRect(position, width, height);
-        draw(g, markerImage, rect, opacity);
-    }
+    // Gridlines never overlap, so they are bucketed by type instead of column:
+    // each type then draws as one run at a single opacity
+    renderCommands.addSprite(DrawOrder::GRID, (uint)gridlineType, markerImage, rect, opacity);
 }
 
 
@@ -166,14 +382,14 @@ void HighwayRenderer::drawGem(uint gemColumn, const GemWrapper& gemWrapper, floa
 
     if (isPart(state, Part::GUITAR))
     {
-        glyphRect = glyphRenderer.getGuitarGlyphRect(gemColumn, position, width, height);
+        glyphRect = perspectiveLayout.getGlyphRect(gemColumn, position);
         bool starPowerActive = state.getProperty("starPower");
         glyphImage = assetManager.getGuitarGlyphImage(gemWrapper, gemColumn, starPowerActive);
         barNote = isBarNote(gemColumn, Part::GUITAR);
     }
     else // if (isPart(state, Part::DRUMS))
     {
-        glyphRect = glyphRenderer.getDrumGlyphRect(gemColumn, position, width, height);
+        glyphRect = perspectiveLayout.getGlyphRect(gemColumn, position);
         bool starPowerActive = state.getProperty("starPower");
         glyphImage = assetManager.getDrumGlyphImage(gemWrapper, gemColumn, starPowerActive);
         barNote = isBarNote(gemColumn, Part::DRUMS);
@@ -186,28 +402,39 @@ void HighwayRenderer::drawGem(uint gemColumn, const GemWrapper& gemWrapper, floa
     }
 
     float opacity = calculateOpacity(position);
-    if (barNote)
-    {
-        drawCallMap[DrawOrder::BAR][gemColumn].push_back([=](juce::Graphics &g) {
-            draw(g, glyphImage, glyphRect, opacity);
-        });
-    }
-    else
+    DrawOrder layer = barNote ? DrawOrder::BAR : DrawOrder::NOTE;
+
+    // Level of detail from the gem's perspective-scaled width on screen
+    float pixelWidth = glyphRect.getWidth() * pixelScale;
+    if (pixelWidth < LOD_SPRITE_MIN_WIDTH)
     {
-        drawCallMap[DrawOrder::NOTE][gemColumn].push_back([=](juce::Graphics &g) {
-            draw(g, glyphImage, glyphRect, opacity);
-        });
+        // Too small to tell sprites apart: a quad in the lane colour
+        Part part = isPart(state, Part::GUITAR) ? Part::GUITAR : Part::DRUMS;
+        uint laneColumn = (part == Part::DRUMS && gemColumn == 6) ? 0 : gemColumn;  // 2x kick shares the kick colour
+        bool shouldBeWhite = (bool)state.getProperty("starPower") && gemWrapper.starPower;
+        juce::Colour colour = assetManager.getLaneColour(laneColumn, part, shouldBeWhite);
+
+        auto quadRect = glyphRect.withSizeKeepingCentre(glyphRect.getWidth(), glyphRect.getHeight() * LOD_QUAD_HEIGHT_RATIO);
+        renderCommands.addFill(layer, gemColumn, quadRect, opacity, colour);
+        return;
     }
 
+    renderCommands.addSprite(layer, gemColumn, glyphImage, glyphRect, opacity);
+
+    if (pixelWidth < LOD_OVERLAY_MIN_WIDTH)
+        return;
+
+    // Distant overlays are too small to read when the frame is over budget
+    if (position > FAR_OVERLAY_CUTOFF && governor.isAtLeast(FrameBudgetGovernor::Quality::NO_FAR_OVERLAYS))
+        return;
+
     juce::Image* overlayImage = assetManager.getOverlayImage(gemWrapper.gem, isPart(state, Part::GUITAR) ? Part::GUITAR : Part::DRUMS);
     if (overlayImage != nullptr)
     {
         bool isDrumAccent = !isPart(state, Part::GUITAR) && gemWrapper.gem == Gem::TAP_ACCENT;
         juce::Rectangle<float> overlayRect = glyphRenderer.getOverlayGlyphRect(glyphRect, isDrumAccent);
 
-        drawCallMap[DrawOrder::OVERLAY][gemColumn].push_back([=](juce::Graphics &g) {
-            draw(g, overlayImage, overlayRect, opacity);
-        });
+        renderCommands.addSprite(DrawOrder::OVERLAY, gemColumn, overlayImage, overlayRect, opacity);
     }
 }
 
@@ -215,7 +442,7 @@ void HighwayRenderer::drawGem(uint gemColumn, const GemWrapper& gemWrapper, floa
 //==============================================================================
 // Sustain Rendering
 
-void HighwayRenderer::drawSustainFromWindow(juce::Graphics &g, const TimeBasedSustainWindow& sustainWindow, double windowStartTime, double windowEndTime)
+void HighwayRenderer::drawSustainFromWindow(const TimeBasedSustainWindow& sustainWindow, double windowStartTime, double windowEndTime)
 {
     for (const auto& sustain : sustainWindow)
     {
@@ -270,36 +497,33 @@ void HighwayRenderer::drawSustain(const TimeBasedSustainEvent& sustain, double w
             break;
     }
 
-    drawCallMap[sustainDrawOrder][sustain.gemColumn].push_back([=](juce::Graphics &g) {
-        drawPerspectiveSustainFlat(g, sustain.gemColumn, startPosition, endPosition, opacity, sustainWidth, colour);
-    });
+    renderCommands.addSustain(sustainDrawOrder, sustain.gemColumn, startPosition, endPosition, sustainWidth, opacity, colour);
 }
 
-void HighwayRenderer::drawPerspectiveSustainFlat(juce::Graphics &g, uint gemColumn, float startPosition, float endPosition, float opacity, float sustainWidth, juce::Colour colour)
+void HighwayRenderer::drawPerspectiveSustainFlat(juce::Graphics &g, ColumnRenderer &columns, uint gemColumn, float startPosition, float endPosition, float opacity, float sustainWidth, juce::Colour colour)
 {
     // Get lane coordinates instead of glyph rectangles
-    auto startLane = isPart(state, Part::DRUMS) ? PositionMath::getDrumLaneCoordinates(gemColumn, startPosition, width, height) : PositionMath::getGuitarLaneCoordinates(gemColumn, startPosition, width, height);
-    auto endLane = isPart(state, Part::DRUMS) ? PositionMath::getDrumLaneCoordinates(gemColumn, endPosition, width, height) : PositionMath::getGuitarLaneCoordinates(gemColumn, endPosition, width, height);
+    auto startLane = perspectiveLayout.getLaneCorners(gemColumn, startPosition);
+    auto endLane = perspectiveLayout.getLaneCorners(gemColumn, endPosition);
     
     // Calculate lane widths based on sustain width parameter
     float startWidth = (startLane.rightX - startLane.leftX) * sustainWidth;
     float endWidth = (endLane.rightX - endLane.leftX) * sustainWidth;
     float radius = std::min(startWidth, endWidth) * SUSTAIN_CAP_RADIUS_SCALE;
-    
-    // Create paths for trapezoid and rounded caps
-    auto trapezoid = columnRenderer.createTrapezoidPath(startLane, endLane, startWidth, endWidth);
-    auto startCap = columnRenderer.createRoundedCapPath(startLane, startWidth, radius);
 
     // Scale end cap height proportionally to width for natural perspective
     float endCapHeightScale = endWidth / startWidth;
-    auto endCap = columnRenderer.createRoundedCapPath(endLane, endWidth, radius, endCapHeightScale);
 
-    // Render to offscreen image for perfect compositing
-    auto sustainImage = columnRenderer.createOffscreenColumnImage(trapezoid, startCap, endCap, colour);
-    
-    // Draw final result
-    g.setOpacity(opacity);
-    auto bounds = trapezoid.getBounds().getUnion(startCap.getBounds()).getUnion(endCap.getBounds());
-    g.drawImageAt(sustainImage, (int)bounds.getX() - 1, (int)bounds.getY() - 1);
+    // Over budget: no caps, coarser rows
+    float rowHeight = 1.0f;
+    if (governor.isAtLeast(FrameBudgetGovernor::Quality::SIMPLE_SUSTAINS))
+    {
+        radius = 0.0f;
+        rowHeight = SIMPLE_SUSTAIN_ROW_HEIGHT;
+    }
+
+    // Body and caps are filled as disjoint spans, so one opacity composites them cleanly
+    columns.fillColumn(g, startLane, endLane, startWidth, endWidth, radius, endCapHeightScale,
+                              colour.withMultipliedAlpha(opacity), rowHeight);
 }
 
@@ -11,16 +11,21 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <optional>
 #include "../../Midi/Processing/MidiInterpreter.h"
 #include "../../Utils/Utils.h"
 #include "../../Utils/TimeConverter.h"
 #include "../Managers/AssetManager.h"
+#include "../Managers/FrameBudgetGovernor.h"
 #include "AnimationRenderer.h"
+#include "RenderCommandBuffer.h"
+#include "SpriteBlitter.h"
 #include "../Utils/PositionConstants.h"
-#include "../Utils/PositionMath.h"
+#include "../Utils/PerspectiveLayout.h"
 #include "../Utils/DrawingConstants.h"
 #include "GlyphRenderer.h"
 #include "ColumnRenderer.h"
+#include "BandRasterizer.h"
 
 
 class HighwayRenderer
@@ -29,7 +34,19 @@ class HighwayRenderer
         HighwayRenderer(juce::ValueTree &state, MidiInterpreter &midiInterpreter);
         ~HighwayRenderer();
 
-        void paint(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, bool isPlaying = true);
+        void paint(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, double cursorTime, bool isPlaying = true);
+
+        // Renders the highway for an area of the given logical size without a Graphics context
+        // (safe off the message thread). Returns the frame buffer at physical resolution; the
+        // caller may swap it for another image, which is then reused for the next frame.
+        // cursorTime is the cursor's absolute chart time in seconds (times in the windows are relative to it).
+        juce::Image& render(uint areaWidth, uint areaHeight, float scale, const TimeBasedTrackWindow& trackWindow, const TimeBasedSustainWindow& sustainWindow, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime, double cursorTime, bool isPlaying = true);
+
+        // Physical pixels per logical pixel of the last rendered frame (below the display's at reduced quality)
+        float getFrameScale() const { return pixelScale; }
+
+        // Time a frame may take before quality is stepped down (0 = never degrade)
+        void setFrameBudgetMs(double ms) { governor.setBudgetMs(ms); }
 
     private:
         juce::ValueTree &state;
@@ -37,9 +54,50 @@ class HighwayRenderer
         AssetManager assetManager;
         AnimationRenderer animationRenderer;
         GlyphRenderer glyphRenderer;
-        ColumnRenderer columnRenderer;
+        PerspectiveLayout perspectiveLayout;        // Rects for this frame's size and part
+        std::vector<float> gridlinePositions;
+        PerspectiveLayout::Rects gridlineRects;
+        std::array<ColumnRenderer, BandRasterizer::MAX_BANDS> columnRenderers;   // One per band
+        BandRasterizer bandRasterizer;
 
         uint width = 0, height = 0;
+        float pixelScale = 1.0f;    // Physical pixels per logical pixel of the frame buffer
+        FrameBudgetGovernor governor;
+
+        // Software ARGB target the highway is composed into at physical resolution,
+        // then drawn to the context in one call
+        juce::Image frameBuffer;
+        void prepareFrameBuffer();
+        float getRenderScale(float displayScale) const;
+
+        // Pre-scaled variant and physical rect of each sorted sprite command (fills get
+        // just the rect), looked up before rasterizing so bands only read the sprite cache.
+        // The image is held by value, so the variant outlives any later cache eviction.
+        struct ResolvedSprite
+        {
+            juce::Image image;          // Invalid: no variant, draw the source through Graphics
+            juce::Rectangle<int> pixelRect;
+        };
+        std::vector<ResolvedSprite> resolvedSprites;
+        void resolveSprites(const std::vector<RenderCommand>& commands);
+
+        // Context and pixel access for frame rows [top, bottom), drawn into image, whose first
+        // row is frame row imageTop (the frame buffer itself, or a band's strip). Created and
+        // destroyed on the rendering thread; band workers only draw through them.
+        struct BandTarget
+        {
+            BandTarget(juce::Image& image, int imageTop, float scale, int top, int bottom);
+
+            juce::Graphics graphics;    // Logical frame coordinates, clipped to the band
+            juce::Image::BitmapData data;
+            int top, bottom;
+        };
+        std::array<std::optional<BandTarget>, BandRasterizer::MAX_BANDS> bandTargets;
+
+        // Private images for the bands that run on pool threads (index 0 is unused)
+        std::array<juce::Image, BandRasterizer::MAX_BANDS> bandStrips;
+        juce::Image& getBandStrip(int band, int rows);
+        void rasterizeBand(const std::vector<RenderCommand>& commands, ColumnRenderer& columns, BandTarget& target);
 
         bool isBarNote(uint gemColumn, Part part)
         {
@@ -64,21 +122,29 @@ class HighwayRenderer
             return 1.0;
         }
 
-        DrawCallMap drawCallMap;
-        void drawGridlinesFromMap(juce::Graphics &g, const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime);
-        void drawGridline(juce::Graphics &g, float position, juce::Image *markerImage, Gridline gridlineType);
+        RenderCommandBuffer renderCommands;
+        void drawGridlinesFromMap(const TimeBasedGridlineMap& gridlines, double windowStartTime, double windowEndTime);
+        void drawGridline(juce::Rectangle<float> rect, juce::Image *markerImage, Gridline gridlineType);
 
-        void drawNotesFromMap(juce::Graphics &g, const TimeBasedTrackWindow& trackWindow, double windowStartTime, double windowEndTime);
+        void drawNotesFromMap(const TimeBasedTrackWindow& trackWindow, double windowStartTime, double windowEndTime);
         void drawFrame(const TimeBasedTrackFrame &gems, float position, double frameTime);
         void drawGem(uint gemColumn, const GemWrapper& gemMods, float position, double frameTime);
 
-        void drawSustainFromWindow(juce::Graphics &g, const TimeBasedSustainWindow& sustainWindow, double windowStartTime, double windowEndTime);
+        void drawSustainFromWindow(const TimeBasedSustainWindow& sustainWindow, double windowStartTime, double windowEndTime);
         void drawSustain(const TimeBasedSustainEvent& sustain, double windowStartTime, double windowEndTime);
-        void drawPerspectiveSustainFlat(juce::Graphics &g, uint gemColumn, float startPosition, float endPosition, float opacity, float sustainWidth, juce::Colour colour);
-        void draw(juce::Graphics &g, juce::Image *image, juce::Rectangle<float> position, float opacity)
+        void drawPerspectiveSustainFlat(juce::Graphics &g, ColumnRenderer &columns, uint gemColumn, float startPosition, float endPosition, float opacity, float sustainWidth, juce::Colour colour);
+        // Sprites go through the blitter into bandData (whose first row is bandTop); g (the band's
+        // context) is only used for sources without a pre-scaled variant, at its current opacity
+        void draw(juce::Graphics &g, juce::Image::BitmapData &bandData, int bandTop, const RenderCommand &command, const ResolvedSprite &sprite)
         {
-            g.setOpacity(opacity);
-            g.drawImage(*image, position);
+            if (sprite.image.isValid())
+            {
+                const juce::Image::BitmapData spriteData(sprite.image, juce::Image::BitmapData::readOnly);
+                SpriteBlitter::blit(bandData, spriteData, sprite.pixelRect.getX(), sprite.pixelRect.getY() - bandTop, command.opacity, command.blend);
+                return;
+            }
+
+            g.drawImage(*command.sprite.image, command.getSpriteRect());
         };
 
         // Sustain rendering helper functions (delegated to ColumnRenderer)
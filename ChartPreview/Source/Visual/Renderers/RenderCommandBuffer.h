@@ -0,0 +1,138 @@
+/*
+    ==============================================================================
+
+        RenderCommandBuffer.h
+
+        Flat list of plain draw records for one frame of the highway.
+        Renderers append sprite, fill and sustain records tagged with their layer
+        (DrawOrder) and column; sort() orders them with a single counting sort
+        over the (layer, column) buckets and the renderer executes the result
+        in one loop. Storage is kept between frames, so once warmed up a frame
+        submits and sorts without allocating.
+
+    ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "../../Utils/Utils.h"
+#include "SpriteBlitter.h"
+
+struct RenderCommand
+{
+    enum class Type : uint8_t
+    {
+        SPRITE,     // Image scaled into a rectangle
+        FILL,       // Solid rectangle (stand-in for sprites too small to read)
+        SUSTAIN     // Perspective sustain/lane between two highway positions
+    };
+
+    struct Sprite
+    {
+        juce::Image* image;
+        float x, y, width, height;
+    };
+
+    struct Fill
+    {
+        float x, y, width, height;
+        juce::uint32 argb;
+    };
+
+    struct Sustain
+    {
+        float startPosition;
+        float endPosition;
+        float widthScale;
+        juce::uint32 argb;
+    };
+
+    Type type;
+    uint8_t bucket;     // (layer << COLUMN_BITS) | column
+    uint8_t column;
+    SpriteBlitter::BlendMode blend;
+    float opacity;
+    union
+    {
+        Sprite sprite;
+        Fill fill;
+        Sustain sustain;
+    };
+
+    juce::Rectangle<float> getSpriteRect() const { return { sprite.x, sprite.y, sprite.width, sprite.height }; }
+    juce::Rectangle<float> getFillRect() const { return { fill.x, fill.y, fill.width, fill.height }; }
+};
+
+class RenderCommandBuffer
+{
+public:
+    static constexpr int COLUMN_BITS = 3;
+    static constexpr size_t BUCKET_COUNT = ((size_t)DrawOrder::NOTE_ANIMATION + 1) << COLUMN_BITS;
+
+    explicit RenderCommandBuffer(size_t initialCapacity = 1024)
+    {
+        commands.reserve(initialCapacity);
+        sorted.reserve(initialCapacity);
+    }
+
+    void clear() { commands.clear(); }
+    size_t size() const { return commands.size(); }
+
+    void addSprite(DrawOrder layer, uint column, juce::Image* image, juce::Rectangle<float> rect, float opacity,
+                   SpriteBlitter::BlendMode blend = SpriteBlitter::BlendMode::NORMAL)
+    {
+        RenderCommand& command = push(RenderCommand::Type::SPRITE, layer, column, opacity);
+        command.blend = blend;
+        command.sprite = { image, rect.getX(), rect.getY(), rect.getWidth(), rect.getHeight() };
+    }
+
+    void addFill(DrawOrder layer, uint column, juce::Rectangle<float> rect, float opacity, juce::Colour colour)
+    {
+        RenderCommand& command = push(RenderCommand::Type::FILL, layer, column, opacity);
+        command.fill = { rect.getX(), rect.getY(), rect.getWidth(), rect.getHeight(), colour.getARGB() };
+    }
+
+    void addSustain(DrawOrder layer, uint column, float startPosition, float endPosition, float widthScale, float opacity, juce::Colour colour)
+    {
+        RenderCommand& command = push(RenderCommand::Type::SUSTAIN, layer, column, opacity);
+        command.sustain = { startPosition, endPosition, widthScale, colour.getARGB() };
+    }
+
+    // Layer by layer, column by column; within a column the latest submission
+    // comes first so earlier (nearer) gems are painted over later (farther) ones
+    const std::vector<RenderCommand>& sort()
+    {
+        std::array<uint32_t, BUCKET_COUNT + 1> offsets {};
+        for (const auto& command : commands)
+            offsets[command.bucket + 1]++;
+        for (size_t i = 1; i <= BUCKET_COUNT; i++)
+            offsets[i] += offsets[i - 1];
+
+        sorted.resize(commands.size());
+        for (auto it = commands.rbegin(); it != commands.rend(); ++it)
+            sorted[offsets[it->bucket]++] = *it;
+
+        return sorted;
+    }
+
+private:
+    RenderCommand& push(RenderCommand::Type type, DrawOrder layer, uint column, float opacity)
+    {
+        jassert(column < (1u << COLUMN_BITS));
+
+        RenderCommand& command = commands.emplace_back();
+        command.type = type;
+        command.bucket = (uint8_t)(((uint)layer << COLUMN_BITS) | column);
+        command.column = (uint8_t)column;
+        command.blend = SpriteBlitter::BlendMode::NORMAL;
+        command.opacity = opacity;
+        return command;
+    }
+
+    std::vector<RenderCommand> commands;
+    std::vector<RenderCommand> sorted;
+};
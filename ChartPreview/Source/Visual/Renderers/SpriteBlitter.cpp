@@ -0,0 +1,325 @@
+/*
+    ==============================================================================
+
+        SpriteBlitter.cpp
+
+        Per-row blend kernels. Every kernel computes, per 8-bit channel c with
+        e = effective opacity in [0, 256] (256 = opaque, as JUCE's full-alpha path):
+
+            NORMAL:   out = min(255, (src*e >> 8) + (dst * (256 - (srcA*e >> 8)) >> 8))
+            ADDITIVE: out = min(255, dst + (src*e >> 8))
+
+        which is the arithmetic of juce::PixelARGB::blend. Products fit in
+        16 bits, so the SIMD kernels work on 16-bit lanes.
+
+    ==============================================================================
+*/
+
+#include "SpriteBlitter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SPRITE_BLITTER_SSE2 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define SPRITE_BLITTER_AVX2_TARGET
+    #else
+        #define SPRITE_BLITTER_AVX2_TARGET __attribute__((target("avx2")))
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define SPRITE_BLITTER_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace
+{
+    using RowKernel = void (*)(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha);
+
+    //==============================================================================
+    // Scalar - two channels at a time in one 32-bit word, like juce::PixelARGB
+
+    inline uint32_t maskComponents(uint32_t x) { return (x >> 8) & 0x00ff00ff; }
+    inline uint32_t clampComponents(uint32_t x) { return (x | (0x01000100 - maskComponents(x))) & 0x00ff00ff; }
+
+    inline uint32_t blendNormal(uint32_t dest, uint32_t source, uint32_t alpha)
+    {
+        uint32_t ag = maskComponents(((source >> 8) & 0x00ff00ff) * alpha);
+        const uint32_t inverse = 0x100 - (ag >> 16);
+        ag += maskComponents(((dest >> 8) & 0x00ff00ff) * inverse);
+        const uint32_t rb = maskComponents((source & 0x00ff00ff) * alpha) + maskComponents((dest & 0x00ff00ff) * inverse);
+        return clampComponents(rb) | (clampComponents(ag) << 8);
+    }
+
+    inline uint32_t blendAdditive(uint32_t dest, uint32_t source, uint32_t alpha)
+    {
+        const uint32_t ag = maskComponents(((source >> 8) & 0x00ff00ff) * alpha) + ((dest >> 8) & 0x00ff00ff);
+        const uint32_t rb = maskComponents((source & 0x00ff00ff) * alpha) + (dest & 0x00ff00ff);
+        return clampComponents(rb) | (clampComponents(ag) << 8);
+    }
+
+    void normalRowScalar(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        for (int i = 0; i < count; i++)
+            dest[i] = blendNormal(dest[i], source[i], alpha);
+    }
+
+    void additiveRowScalar(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        for (int i = 0; i < count; i++)
+            dest[i] = blendAdditive(dest[i], source[i], alpha);
+    }
+
+   #if SPRITE_BLITTER_SSE2
+    //==============================================================================
+    // SSE2 - 4 pixels per step
+
+    inline __m128i normalSSE2(__m128i dest, __m128i source, __m128i alpha)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i full = _mm_set1_epi16(256);
+        const __m128i max = _mm_set1_epi16(255);
+
+        __m128i result[2];
+        for (int half = 0; half < 2; half++)
+        {
+            __m128i s = half == 0 ? _mm_unpacklo_epi8(source, zero) : _mm_unpackhi_epi8(source, zero);
+            __m128i d = half == 0 ? _mm_unpacklo_epi8(dest, zero) : _mm_unpackhi_epi8(dest, zero);
+
+            s = _mm_srli_epi16(_mm_mullo_epi16(s, alpha), 8);
+            __m128i sourceAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xff), 0xff);
+            d = _mm_srli_epi16(_mm_mullo_epi16(d, _mm_sub_epi16(full, sourceAlpha)), 8);
+            result[half] = _mm_min_epi16(_mm_add_epi16(s, d), max);
+        }
+        return _mm_packus_epi16(result[0], result[1]);
+    }
+
+    inline __m128i additiveSSE2(__m128i dest, __m128i source, __m128i alpha)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(source, zero), alpha), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(source, zero), alpha), 8);
+        return _mm_adds_epu8(dest, _mm_packus_epi16(lo, hi));
+    }
+
+    void normalRowSSE2(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const __m128i alphaVec = _mm_set1_epi16((short)alpha);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i d = _mm_loadu_si128((const __m128i*)(dest + i));
+            __m128i s = _mm_loadu_si128((const __m128i*)(source + i));
+            _mm_storeu_si128((__m128i*)(dest + i), normalSSE2(d, s, alphaVec));
+        }
+        normalRowScalar(dest + i, source + i, count - i, alpha);
+    }
+
+    void additiveRowSSE2(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const __m128i alphaVec = _mm_set1_epi16((short)alpha);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i d = _mm_loadu_si128((const __m128i*)(dest + i));
+            __m128i s = _mm_loadu_si128((const __m128i*)(source + i));
+            _mm_storeu_si128((__m128i*)(dest + i), additiveSSE2(d, s, alphaVec));
+        }
+        additiveRowScalar(dest + i, source + i, count - i, alpha);
+    }
+
+    //==============================================================================
+    // AVX2 - 8 pixels per step (unpack/pack stay within 128-bit lanes, so order is preserved)
+
+    SPRITE_BLITTER_AVX2_TARGET
+    void normalRowAVX2(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i full = _mm256_set1_epi16(256);
+        const __m256i max = _mm256_set1_epi16(255);
+        const __m256i alphaVec = _mm256_set1_epi16((short)alpha);
+
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i dest8 = _mm256_loadu_si256((const __m256i*)(dest + i));
+            __m256i source8 = _mm256_loadu_si256((const __m256i*)(source + i));
+
+            __m256i sLo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(source8, zero), alphaVec), 8);
+            __m256i sHi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(source8, zero), alphaVec), 8);
+            __m256i aLo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sLo, 0xff), 0xff);
+            __m256i aHi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sHi, 0xff), 0xff);
+            __m256i dLo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dest8, zero), _mm256_sub_epi16(full, aLo)), 8);
+            __m256i dHi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dest8, zero), _mm256_sub_epi16(full, aHi)), 8);
+
+            __m256i lo = _mm256_min_epi16(_mm256_add_epi16(sLo, dLo), max);
+            __m256i hi = _mm256_min_epi16(_mm256_add_epi16(sHi, dHi), max);
+            _mm256_storeu_si256((__m256i*)(dest + i), _mm256_packus_epi16(lo, hi));
+        }
+        normalRowSSE2(dest + i, source + i, count - i, alpha);
+    }
+
+    SPRITE_BLITTER_AVX2_TARGET
+    void additiveRowAVX2(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i alphaVec = _mm256_set1_epi16((short)alpha);
+
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i dest8 = _mm256_loadu_si256((const __m256i*)(dest + i));
+            __m256i source8 = _mm256_loadu_si256((const __m256i*)(source + i));
+
+            __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(source8, zero), alphaVec), 8);
+            __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(source8, zero), alphaVec), 8);
+            _mm256_storeu_si256((__m256i*)(dest + i), _mm256_adds_epu8(dest8, _mm256_packus_epi16(lo, hi)));
+        }
+        additiveRowSSE2(dest + i, source + i, count - i, alpha);
+    }
+   #endif
+
+   #if SPRITE_BLITTER_NEON
+    //==============================================================================
+    // NEON - 4 pixels per step
+
+    inline uint16x8_t scaleNEON(uint8x8_t channels, uint16x8_t alpha)
+    {
+        return vshrq_n_u16(vmulq_u16(vmovl_u8(channels), alpha), 8);
+    }
+
+    inline uint8x8_t normalHalfNEON(uint8x8_t dest, uint8x8_t source, uint16x8_t alpha)
+    {
+        uint16x8_t s = scaleNEON(source, alpha);
+        uint16x8_t sourceAlpha = vcombine_u16(vdup_lane_u16(vget_low_u16(s), 3), vdup_lane_u16(vget_high_u16(s), 3));
+        uint16x8_t d = vshrq_n_u16(vmulq_u16(vmovl_u8(dest), vsubq_u16(vdupq_n_u16(256), sourceAlpha)), 8);
+        return vmovn_u16(vminq_u16(vaddq_u16(s, d), vdupq_n_u16(255)));
+    }
+
+    void normalRowNEON(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const uint16x8_t alphaVec = vdupq_n_u16((uint16_t)alpha);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            uint8x16_t d = vld1q_u8((const uint8_t*)(dest + i));
+            uint8x16_t s = vld1q_u8((const uint8_t*)(source + i));
+            uint8x8_t lo = normalHalfNEON(vget_low_u8(d), vget_low_u8(s), alphaVec);
+            uint8x8_t hi = normalHalfNEON(vget_high_u8(d), vget_high_u8(s), alphaVec);
+            vst1q_u8((uint8_t*)(dest + i), vcombine_u8(lo, hi));
+        }
+        normalRowScalar(dest + i, source + i, count - i, alpha);
+    }
+
+    void additiveRowNEON(uint32_t* dest, const uint32_t* source, int count, uint32_t alpha)
+    {
+        const uint16x8_t alphaVec = vdupq_n_u16((uint16_t)alpha);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            uint8x16_t d = vld1q_u8((const uint8_t*)(dest + i));
+            uint8x16_t s = vld1q_u8((const uint8_t*)(source + i));
+            uint8x16_t scaled = vcombine_u8(vmovn_u16(scaleNEON(vget_low_u8(s), alphaVec)),
+                                            vmovn_u16(scaleNEON(vget_high_u8(s), alphaVec)));
+            vst1q_u8((uint8_t*)(dest + i), vqaddq_u8(d, scaled));
+        }
+        additiveRowScalar(dest + i, source + i, count - i, alpha);
+    }
+   #endif
+
+    //==============================================================================
+
+    struct Kernels
+    {
+        RowKernel normal = normalRowScalar;
+        RowKernel additive = additiveRowScalar;
+        const char* name = "scalar";
+    };
+
+    // Kernels for one instruction set; scalar if it isn't available
+    Kernels getKernels(SpriteBlitter::Kernel kernel)
+    {
+        switch (kernel)
+        {
+           #if SPRITE_BLITTER_SSE2
+            case SpriteBlitter::Kernel::AVX2:
+                if (juce::SystemStats::hasAVX2())
+                    return { normalRowAVX2, additiveRowAVX2, "AVX2" };
+                break;
+            case SpriteBlitter::Kernel::SSE2:
+                return { normalRowSSE2, additiveRowSSE2, "SSE2" };
+           #elif SPRITE_BLITTER_NEON
+            case SpriteBlitter::Kernel::NEON:
+                return { normalRowNEON, additiveRowNEON, "NEON" };
+           #endif
+            default:
+                break;
+        }
+        return {};
+    }
+
+    const Kernels& getKernels()
+    {
+        static const Kernels kernels = []
+        {
+           #if SPRITE_BLITTER_SSE2
+            return getKernels(juce::SystemStats::hasAVX2() ? SpriteBlitter::Kernel::AVX2 : SpriteBlitter::Kernel::SSE2);
+           #elif SPRITE_BLITTER_NEON
+            return getKernels(SpriteBlitter::Kernel::NEON);
+           #else
+            return getKernels(SpriteBlitter::Kernel::SCALAR);
+           #endif
+        }();
+        return kernels;
+    }
+
+    void blitRows(juce::Image::BitmapData& dest, const juce::Image::BitmapData& source,
+                  int x, int y, float opacity, SpriteBlitter::BlendMode mode, const Kernels& kernels)
+    {
+        jassert(dest.pixelFormat == juce::Image::ARGB && source.pixelFormat == juce::Image::ARGB);
+
+        // Same 8-bit opacity as Graphics::setOpacity, scaled like JUCE's image fill on
+        // fully covered (pixel-aligned) rows: alpha + 1, saturating to an opaque blend
+        const uint32_t colourAlpha = opacity <= 0.0f ? 0 : (opacity >= 1.0f ? 255 : (uint32_t)juce::roundToInt(opacity * 255.0f));
+        if (colourAlpha == 0) return;
+        uint32_t alpha = colourAlpha + 1;
+        if (alpha >= 0xfe) alpha = 256;
+
+        // Clip to the framebuffer
+        const int left = std::max(0, x);
+        const int top = std::max(0, y);
+        const int right = std::min(dest.width, x + source.width);
+        const int bottom = std::min(dest.height, y + source.height);
+        if (right <= left || bottom <= top) return;
+
+        const RowKernel kernel = mode == SpriteBlitter::BlendMode::ADDITIVE ? kernels.additive : kernels.normal;
+
+        for (int row = top; row < bottom; row++)
+        {
+            auto* destRow = reinterpret_cast<uint32_t*>(dest.getPixelPointer(left, row));
+            auto* sourceRow = reinterpret_cast<const uint32_t*>(source.getPixelPointer(left - x, row - y));
+            kernel(destRow, sourceRow, right - left, alpha);
+        }
+    }
+}
+
+void SpriteBlitter::blit(juce::Image::BitmapData& dest, const juce::Image::BitmapData& source,
+                         int x, int y, float opacity, BlendMode mode)
+{
+    blitRows(dest, source, x, y, opacity, mode, getKernels());
+}
+
+void SpriteBlitter::blit(juce::Image::BitmapData& dest, const juce::Image::BitmapData& source,
+                         int x, int y, float opacity, BlendMode mode, Kernel kernel)
+{
+    jassert(isKernelAvailable(kernel));
+    blitRows(dest, source, x, y, opacity, mode, getKernels(kernel));
+}
+
+bool SpriteBlitter::isKernelAvailable(Kernel kernel)
+{
+    return kernel == Kernel::SCALAR || getKernels(kernel).normal != normalRowScalar;
+}
+
+const char* SpriteBlitter::getKernelName()
+{
+    return getKernels().name;
+}
@@ -0,0 +1,179 @@
+/*
+    ==============================================================================
+
+        SpriteBlitterTests.cpp
+
+        Checks every SpriteBlitter kernel this machine can run. NORMAL must
+        match Graphics::drawImageAt on JUCE's software renderer bit for bit;
+        ADDITIVE has no JUCE equivalent, so it is checked against the
+        saturating add it documents. Pixels are random premultiplied ARGB,
+        opacities cover the 8-bit edge cases (0, 0xfe, 0xff) and sprites are
+        placed inside, across every edge and corner, and fully outside.
+
+        Debug builds run these once per process when the first editor opens.
+
+    ==============================================================================
+*/
+
+#include "SpriteBlitter.h"
+
+#ifdef DEBUG
+
+class SpriteBlitterTests : public juce::UnitTest
+{
+public:
+    SpriteBlitterTests() : juce::UnitTest("SpriteBlitter", "ChartPreview") {}
+
+    void runTest() override
+    {
+        random = getRandom();
+
+        const std::pair<SpriteBlitter::Kernel, const char*> kernels[] = {
+            { SpriteBlitter::Kernel::SCALAR, "scalar" },
+            { SpriteBlitter::Kernel::SSE2, "SSE2" },
+            { SpriteBlitter::Kernel::AVX2, "AVX2" },
+            { SpriteBlitter::Kernel::NEON, "NEON" }
+        };
+
+        for (const auto& [kernel, name] : kernels)
+        {
+            if (!SpriteBlitter::isKernelAvailable(kernel))
+            {
+                logMessage(juce::String(name) + " kernel not available, skipped");
+                continue;
+            }
+
+            beginTest(juce::String("NORMAL matches drawImageAt (") + name + ")");
+            runBlendTests(kernel, SpriteBlitter::BlendMode::NORMAL);
+
+            beginTest(juce::String("ADDITIVE matches the saturating add (") + name + ")");
+            runBlendTests(kernel, SpriteBlitter::BlendMode::ADDITIVE);
+        }
+    }
+
+private:
+    static constexpr int DEST_WIDTH = 41, DEST_HEIGHT = 23;
+
+    juce::Random random;
+
+    void runBlendTests(SpriteBlitter::Kernel kernel, SpriteBlitter::BlendMode mode)
+    {
+        // Widths exercise the 8- and 4-pixel steps plus a scalar tail
+        const juce::Point<int> spriteSizes[] = { { 13, 9 }, { 31, 5 }, { 3, 3 } };
+        const int opacities[] = { 0x00, 0x01, 0x40, 0x7f, 0x80, 0xc0, 0xfd, 0xfe, 0xff };
+
+        for (auto size : spriteSizes)
+        {
+            for (auto position : getPositions(size.x, size.y))
+            {
+                for (int opacity : opacities)
+                {
+                    auto dest = createRandomImage(DEST_WIDTH, DEST_HEIGHT);
+                    auto sprite = createRandomImage(size.x, size.y);
+                    const float opacityFloat = (float)opacity / 255.0f;
+
+                    auto expected = mode == SpriteBlitter::BlendMode::NORMAL
+                                        ? drawWithGraphics(dest, sprite, position, opacityFloat)
+                                        : addByFormula(dest, sprite, position, opacity);
+
+                    auto actual = dest.createCopy();
+                    {
+                        juce::Image::BitmapData destData(actual, juce::Image::BitmapData::readWrite);
+                        const juce::Image::BitmapData spriteData(sprite, juce::Image::BitmapData::readOnly);
+                        SpriteBlitter::blit(destData, spriteData, position.x, position.y, opacityFloat, mode, kernel);
+                    }
+
+                    expectEquals(countDifferentPixels(expected, actual), 0,
+                                 "sprite " + juce::String(size.x) + "x" + juce::String(size.y)
+                                 + " at " + position.toString() + ", opacity 0x" + juce::String::toHexString(opacity));
+                }
+            }
+        }
+    }
+
+    // Inside, across each edge, over each corner, and fully outside on every side
+    static std::vector<juce::Point<int>> getPositions(int width, int height)
+    {
+        const int xs[] = { -width, -width / 2, 0, (DEST_WIDTH - width) / 2, DEST_WIDTH - width, DEST_WIDTH - width / 2, DEST_WIDTH };
+        const int ys[] = { -height, -height / 2, 0, (DEST_HEIGHT - height) / 2, DEST_HEIGHT - height, DEST_HEIGHT - height / 2, DEST_HEIGHT };
+
+        std::vector<juce::Point<int>> positions;
+        for (int x : xs)
+            for (int y : ys)
+                positions.push_back({ x, y });
+        return positions;
+    }
+
+    juce::Image createRandomImage(int width, int height)
+    {
+        juce::Image image(juce::Image::ARGB, width, height, false, juce::SoftwareImageType());
+        juce::Image::BitmapData data(image, juce::Image::BitmapData::writeOnly);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                // Premultiplied, so no channel exceeds alpha; fully transparent and opaque pixels turn up often
+                const int choice = random.nextInt(8);
+                const int alpha = choice == 0 ? 0 : (choice == 1 ? 255 : random.nextInt(256));
+                auto channel = [this, alpha] { return (juce::uint8)random.nextInt(alpha + 1); };
+                reinterpret_cast<juce::PixelARGB*>(data.getPixelPointer(x, y))->setARGB((juce::uint8)alpha, channel(), channel(), channel());
+            }
+        }
+        return image;
+    }
+
+    static juce::Image drawWithGraphics(const juce::Image& dest, const juce::Image& sprite, juce::Point<int> position, float opacity)
+    {
+        auto result = dest.createCopy();
+        juce::Graphics g(result);
+        g.setOpacity(opacity);
+        g.drawImageAt(sprite, position.x, position.y);
+        return result;
+    }
+
+    // out = min(255, dest + (source * e >> 8)) per channel, with e the opacity as JUCE's image fill scales it
+    static juce::Image addByFormula(const juce::Image& dest, const juce::Image& sprite, juce::Point<int> position, int opacity)
+    {
+        auto result = dest.createCopy();
+        if (opacity == 0)
+            return result;
+
+        const int extraAlpha = opacity + 1 >= 0xfe ? 256 : opacity + 1;
+        juce::Image::BitmapData resultData(result, juce::Image::BitmapData::readWrite);
+        const juce::Image::BitmapData spriteData(sprite, juce::Image::BitmapData::readOnly);
+
+        for (int y = 0; y < sprite.getHeight(); y++)
+        {
+            for (int x = 0; x < sprite.getWidth(); x++)
+            {
+                const int destX = position.x + x, destY = position.y + y;
+                if (destX < 0 || destY < 0 || destX >= result.getWidth() || destY >= result.getHeight())
+                    continue;
+
+                const auto* source = spriteData.getPixelPointer(x, y);
+                auto* target = resultData.getPixelPointer(destX, destY);
+                for (int channel = 0; channel < 4; channel++)
+                    target[channel] = (juce::uint8)juce::jmin(255, target[channel] + ((source[channel] * extraAlpha) >> 8));
+            }
+        }
+        return result;
+    }
+
+    static int countDifferentPixels(const juce::Image& a, const juce::Image& b)
+    {
+        const juce::Image::BitmapData aData(a, juce::Image::BitmapData::readOnly);
+        const juce::Image::BitmapData bData(b, juce::Image::BitmapData::readOnly);
+
+        int different = 0;
+        for (int y = 0; y < a.getHeight(); y++)
+            for (int x = 0; x < a.getWidth(); x++)
+                if (std::memcmp(aData.getPixelPointer(x, y), bData.getPixelPointer(x, y), 4) != 0)
+                    different++;
+        return different;
+    }
+};
+
+static SpriteBlitterTests spriteBlitterTests;
+
+#endif
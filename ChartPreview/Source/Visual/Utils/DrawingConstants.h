@@ -32,3 +32,27 @@ constexpr float HALF_BEAT_OPACITY = 0.3f;    // Gridline opacity for half-beat l
 // Hit animation rendering opacity
 constexpr float HIT_FLASH_OPACITY = 0.8f;    // Hit flash frame opacity at strikeline
 constexpr float HIT_FLARE_OPACITY = 0.6f;    // Colored flare overlay opacity
+
+//==============================================================================
+// Level of Detail (sizes in physical pixels, so high-DPI displays keep more detail)
+//==============================================================================
+
+constexpr float LOD_OVERLAY_MIN_WIDTH = 24.0f;      // Narrower gems are drawn without their overlay
+constexpr float LOD_SPRITE_MIN_WIDTH = 10.0f;       // Narrower gems are drawn as solid quads
+constexpr float LOD_QUAD_HEIGHT_RATIO = 0.5f;       // Quad height relative to the gem's rect
+constexpr float LOD_GRIDLINE_MIN_GAP = 6.0f;        // Closer beat/half-beat lines are thinned out
+
+//==============================================================================
+// Reduced Quality (frame budget governor)
+//==============================================================================
+
+constexpr float FAR_OVERLAY_CUTOFF = 0.5f;          // Position past which overlays are dropped
+constexpr float SIMPLE_SUSTAIN_ROW_HEIGHT = 3.0f;   // Span height of simplified sustains (logical px)
+constexpr float REDUCED_RESOLUTION_SCALE = 0.75f;   // Internal resolution at the lowest quality
+
+//==============================================================================
+// Render Scale
+//==============================================================================
+
+constexpr float MIN_RENDER_SCALE = 0.5f;                     // Lowest internal resolution "Auto" picks
+constexpr double AUTO_RENDER_SCALE_PIXELS = 1920.0 * 1080.0; // Physical pixels "Auto" rasterizes at most
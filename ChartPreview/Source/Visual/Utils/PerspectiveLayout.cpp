@@ -0,0 +1,152 @@
+/*
+    ==============================================================================
+
+        PerspectiveLayout.cpp
+
+    ==============================================================================
+*/
+
+#include "PerspectiveLayout.h"
+
+using namespace PositionConstants;
+
+PerspectiveLayout::PerspectiveLayout()
+{
+    for (int i = 0; i <= PROGRESS_TABLE_SIZE; i++)
+        progressTable[(size_t)i] = exactProgress((float)i / PROGRESS_TABLE_SIZE);
+}
+
+float PerspectiveLayout::exactProgress(float position)
+{
+    // Same curve as createPerspectiveGlyphRect: 1 at the strikeline, 0 at the far end
+    auto perspParams = getPerspectiveParams();
+    return (std::pow(10, perspParams.exponentialCurve * (1 - position)) - 1) / (std::pow(10, perspParams.exponentialCurve) - 1);
+}
+
+float PerspectiveLayout::getProgress(float position) const
+{
+    if (position < 0.0f || position > 1.0f)
+        return exactProgress(position);
+
+    float t = position * PROGRESS_TABLE_SIZE;
+    int index = std::min((int)t, PROGRESS_TABLE_SIZE - 1);
+    float fraction = t - (float)index;
+    return progressTable[(size_t)index] + (progressTable[(size_t)index + 1] - progressTable[(size_t)index]) * fraction;
+}
+
+//==============================================================================
+// Tables
+
+PerspectiveLayout::ColumnLayout PerspectiveLayout::buildColumn(const NormalizedCoordinates& coords, float sizeScaler,
+                                                               bool isBarNote, uint width, uint height)
+{
+    auto perspParams = getPerspectiveParams();
+
+    // Scaled and re-centred on the column's unscaled centre
+    float normWidth1 = coords.normWidth1 * sizeScaler;
+    float normWidth2 = coords.normWidth2 * sizeScaler;
+    float normX1 = coords.normX1 + (coords.normWidth1 - normWidth1) / 2.0f;
+    float normX2 = coords.normX2 + (coords.normWidth2 - normWidth2) / 2.0f;
+
+    float targetWidth = normWidth2 * width;
+    float targetHeight = targetWidth / (isBarNote ? perspParams.barNoteHeightRatio : perspParams.regularNoteHeightRatio);
+    float perspectiveSlope = perspParams.highwayDepth / perspParams.playerDistance * perspParams.perspectiveStrength;
+
+    ColumnLayout column;
+    column.x = { normX2 * width + targetWidth * perspParams.xOffsetMultiplier - targetWidth / 2.0f, (normX1 - normX2) * width };
+    column.y = { coords.normY2 * height - targetHeight / 2.0f, (coords.normY1 - coords.normY2) * height };
+    column.width = { normWidth2 * width, (normWidth1 - normWidth2) * width };
+    column.height = { targetHeight, targetHeight * perspectiveSlope };
+    return column;
+}
+
+void PerspectiveLayout::update(Part part, uint width, uint height)
+{
+    if (part == currentPart && width == currentWidth && height == currentHeight)
+        return;
+
+    currentPart = part;
+    currentWidth = width;
+    currentHeight = height;
+
+    for (uint column = 0; column < MAX_COLUMNS; column++)
+    {
+        if (part == Part::GUITAR)
+        {
+            bool isOpen = (column == 0);
+            glyphs[column] = buildColumn(isOpen ? getGuitarOpenNoteCoords() : getGuitarNoteCoords(column),
+                                         isOpen ? BAR_SIZE : GEM_SIZE, isOpen, width, height);
+            lanes[column] = buildColumn(guitarLaneCoords[std::min(column, 5u)], isOpen ? 0.95f : 0.9f, isOpen, width, height);
+        }
+        else // if (part == Part::DRUMS)
+        {
+            bool isKick = (column == 0 || column == 6);
+            glyphs[column] = buildColumn(isKick ? getDrumKickCoords() : getDrumPadCoords(column),
+                                         isKick ? BAR_SIZE : GEM_SIZE, isKick, width, height);
+            lanes[column] = buildColumn(drumLaneCoords[isKick ? 0 : std::min(column, 4u)], isKick ? 0.95f : 0.9f, isKick, width, height);
+        }
+    }
+
+    gridline = buildColumn(part == Part::GUITAR ? getGuitarOpenNoteCoords() : getDrumKickCoords(), GRIDLINE_SIZE, true, width, height);
+}
+
+//==============================================================================
+// Lookups
+
+juce::Rectangle<float> PerspectiveLayout::getRect(const ColumnLayout& column, float position) const
+{
+    float progress = getProgress(position);
+    float depth = 1.0f - position;
+    return { column.x.base + column.x.slope * progress,
+             column.y.base + column.y.slope * progress,
+             column.width.base + column.width.slope * progress,
+             column.height.base + column.height.slope * depth };
+}
+
+LaneCorners PerspectiveLayout::getLaneCorners(uint column, float position) const
+{
+    auto rect = getRect(lanes[clampColumn(column)], position);
+    return { rect.getX(), rect.getRight(), rect.getCentreY() };
+}
+
+const PerspectiveLayout::ColumnLayout& PerspectiveLayout::getTarget(Target target, uint column) const
+{
+    switch (target)
+    {
+        case Target::GRIDLINE: return gridline;
+        case Target::GLYPH:
+        default: return glyphs[clampColumn(column)];
+    }
+}
+
+void PerspectiveLayout::layout(Target target, uint column, const float* positions, size_t count, Rects& out)
+{
+    out.x.resize(count);
+    out.y.resize(count);
+    out.width.resize(count);
+    out.height.resize(count);
+    if (count == 0) return;
+
+    progressScratch.resize(count);
+    depthScratch.resize(count);
+
+    // The curve is a table gather; everything after it is straight vector arithmetic
+    for (size_t i = 0; i < count; i++)
+        progressScratch[i] = getProgress(positions[i]);
+
+    const int n = (int)count;
+    juce::FloatVectorOperations::fill(depthScratch.data(), 1.0f, n);
+    juce::FloatVectorOperations::subtract(depthScratch.data(), positions, n);
+
+    const auto& columnLayout = getTarget(target, column);
+    auto apply = [n](float* dest, const float* t, const Line& line)
+    {
+        juce::FloatVectorOperations::copyWithMultiply(dest, t, line.slope, n);
+        juce::FloatVectorOperations::add(dest, line.base, n);
+    };
+
+    apply(out.x.data(), progressScratch.data(), columnLayout.x);
+    apply(out.y.data(), progressScratch.data(), columnLayout.y);
+    apply(out.width.data(), progressScratch.data(), columnLayout.width);
+    apply(out.height.data(), depthScratch.data(), columnLayout.height);
+}
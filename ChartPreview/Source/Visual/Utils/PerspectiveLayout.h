@@ -0,0 +1,94 @@
+/*
+    ==============================================================================
+
+        PerspectiveLayout.h
+
+        Per-frame layout tables for the highway's perspective transform.
+        createPerspectiveGlyphRect is linear in two terms of the depth: the
+        exponential progress (x, y and width) and the inverse depth (height).
+        update() folds everything else (coordinate tables, size scalers,
+        editor size) into a line per column and rect edge, once per size and
+        part. The progress curve, the only transcendental, comes from a table
+        shared by every column. A rect is then a lookup and four multiply-adds,
+        and layout() does a whole array of positions with vector operations.
+
+        Results match the exact perspective curve to well under a pixel.
+        Positions outside [0, 1] fall back to the exact curve.
+
+    ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include "../../Utils/Utils.h"
+#include "PositionConstants.h"
+
+class PerspectiveLayout
+{
+public:
+    static constexpr uint MAX_COLUMNS = 7;          // Guitar open + 5, drum kick + 4 pads + 2x kick
+    static constexpr int PROGRESS_TABLE_SIZE = 1024;
+
+    // Which rects a layout call produces
+    enum class Target
+    {
+        GLYPH,      // Gems, per column
+        GRIDLINE    // Gridlines (column ignored)
+    };
+
+    // Structure-of-arrays output of layout()
+    struct Rects
+    {
+        std::vector<float> x, y, width, height;
+        juce::Rectangle<float> operator[](size_t i) const { return { x[i], y[i], width[i], height[i] }; }
+    };
+
+    PerspectiveLayout();
+
+    // Rebuilds the tables if the part or size changed
+    void update(Part part, uint width, uint height);
+
+    juce::Rectangle<float> getGlyphRect(uint column, float position) const { return getRect(glyphs[clampColumn(column)], position); }
+    PositionConstants::LaneCorners getLaneCorners(uint column, float position) const;
+
+    // Rects for count positions of one target in a single pass
+    void layout(Target target, uint column, const float* positions, size_t count, Rects& out);
+
+private:
+    // value = base + slope * t
+    struct Line
+    {
+        float base = 0.0f, slope = 0.0f;
+    };
+
+    // x, y and width follow the progress curve, height the inverse depth (1 - position)
+    struct ColumnLayout
+    {
+        Line x, y, width, height;
+    };
+
+    static ColumnLayout buildColumn(const PositionConstants::NormalizedCoordinates& coords, float sizeScaler,
+                                    bool isBarNote, uint width, uint height);
+    static float exactProgress(float position);
+
+    float getProgress(float position) const;
+    juce::Rectangle<float> getRect(const ColumnLayout& column, float position) const;
+    const ColumnLayout& getTarget(Target target, uint column) const;
+    static uint clampColumn(uint column) { return column < MAX_COLUMNS ? column : MAX_COLUMNS - 1; }
+
+    std::array<float, PROGRESS_TABLE_SIZE + 1> progressTable;
+
+    Part currentPart = Part::GUITAR;
+    uint currentWidth = 0, currentHeight = 0;
+
+    std::array<ColumnLayout, MAX_COLUMNS> glyphs;
+    std::array<ColumnLayout, MAX_COLUMNS> lanes;
+    ColumnLayout gridline;
+
+    std::vector<float> progressScratch, depthScratch;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PerspectiveLayout)
+};
@@ -6,7 +6,7 @@
         Author: Noah Baxter
 
         This file contains positioning constants and coordinate lookup tables.
-        All mathematical calculations are in PositionMath.
+        The perspective math that uses them is in PerspectiveLayout.
 
     ==============================================================================
 */